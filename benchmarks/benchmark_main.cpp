@@ -0,0 +1,9 @@
+/**
+ * Copyright (C) 2021 - Marcel Breyer - All Rights Reserved
+ * Licensed under the MIT License. See LICENSE.md file in the project root for full license information.
+ *
+ * Main file for the Catch2 benchmarks (CATCH_CONFIG_ENABLE_BENCHMARKING is defined for all benchmark files in the CMakeLists.txt).
+ */
+
+#define CATCH_CONFIG_MAIN
+#include "catch/catch.hpp"
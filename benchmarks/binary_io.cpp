@@ -0,0 +1,51 @@
+/**
+ * Copyright (C) 2021 - Marcel Breyer - All Rights Reserved
+ * Licensed under the MIT License. See LICENSE.md file in the project root for full license information.
+ *
+ * Implements benchmarks comparing the binary serialization of a cpp_util::dynarray with writing and reading it element by element.
+ */
+
+#include "binary_io.hpp"
+
+#include "catch/catch.hpp"
+
+#include <cstddef>  // std::size_t
+#include <sstream>  // std::stringstream
+#include <string>   // std::string
+
+TEST_CASE("binary serialization benchmarks", "[binary_io]") {
+    constexpr std::size_t size = 1 << 22;
+    cpp_util::dynarray<double> arr(size);
+    arr.iota();
+
+    // the previous implementation: one formatted write per element
+    BENCHMARK("element-wise write") {
+        std::stringstream stream;
+        for (const double d : arr) {
+            stream.write(reinterpret_cast<const char*>(&d), sizeof(d));
+        }
+        return stream.tellp();
+    };
+    BENCHMARK("write_binary") {
+        std::stringstream stream;
+        cpp_util::write_binary(stream, arr);
+        return stream.tellp();
+    };
+
+    std::stringstream serialized;
+    cpp_util::write_binary(serialized, arr);
+    const std::string data = serialized.str();
+
+    BENCHMARK("element-wise read") {
+        std::stringstream stream{ data.substr(64) };
+        cpp_util::dynarray<double> read(size);
+        for (double& d : read) {
+            stream.read(reinterpret_cast<char*>(&d), sizeof(d));
+        }
+        return read;
+    };
+    BENCHMARK("read_binary") {
+        std::stringstream stream{ data };
+        return cpp_util::read_binary<double>(stream);
+    };
+}
@@ -0,0 +1,69 @@
+/**
+ * Copyright (C) 2021 - Marcel Breyer - All Rights Reserved
+ * Licensed under the MIT License. See LICENSE.md file in the project root for full license information.
+ *
+ * Implements benchmarks comparing the cpp_util::bit_dynarray class with a cpp_util::dynarray<bool> for sparse membership flags.
+ * The bit-packed array uses 8x less memory and counts or scans 64 flags per word operation.
+ */
+
+#include "bit_dynarray.hpp"
+#include "dynarray.hpp"
+
+#include "catch/catch.hpp"
+
+#include <algorithm>  // std::count
+#include <cstddef>    // std::size_t
+
+namespace {
+
+constexpr std::size_t num_flags = std::size_t{ 1 } << 26;
+// every 1000-th flag is set
+constexpr std::size_t stride = 1000;
+
+}  // namespace
+
+TEST_CASE("bit_dynarray benchmarks", "[bit_dynarray]") {
+    cpp_util::dynarray<bool> bytes(num_flags, false);
+    cpp_util::bit_dynarray<> bits(num_flags);
+    for (std::size_t pos = 0; pos < num_flags; pos += stride) {
+        bytes[pos] = true;
+        bits.set(pos);
+    }
+
+    BENCHMARK("dynarray<bool>: fill") {
+        bytes.fill(false);
+        return bytes.data();
+    };
+    BENCHMARK("bit_dynarray: fill") {
+        bits.fill(false);
+        return bits.words();
+    };
+    for (std::size_t pos = 0; pos < num_flags; pos += stride) {
+        bytes[pos] = true;
+        bits.set(pos);
+    }
+
+    BENCHMARK("dynarray<bool>: count") {
+        return std::count(bytes.begin(), bytes.end(), true);
+    };
+    BENCHMARK("bit_dynarray: count") {
+        return bits.count();
+    };
+
+    BENCHMARK("dynarray<bool>: iterate set flags") {
+        std::size_t sum = 0;
+        for (std::size_t pos = 0; pos < bytes.size(); ++pos) {
+            if (bytes[pos]) {
+                sum += pos;
+            }
+        }
+        return sum;
+    };
+    BENCHMARK("bit_dynarray: iterate set flags") {
+        std::size_t sum = 0;
+        for (const std::size_t pos : bits.set_bits()) {
+            sum += pos;
+        }
+        return sum;
+    };
+}
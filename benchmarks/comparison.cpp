@@ -0,0 +1,63 @@
+/**
+ * Copyright (C) 2021 - Marcel Breyer - All Rights Reserved
+ * Licensed under the MIT License. See LICENSE.md file in the project root for full license information.
+ *
+ * Implements benchmarks for the comparison operators of the cpp_util::dynarray class.
+ * The bitwise comparisons of integral types are compared against the generic element-wise comparisons.
+ */
+
+#include "dynarray.hpp"
+
+#include "catch/catch.hpp"
+
+#include <cstddef>  // std::size_t
+#include <cstdint>  // std::uint8_t, std::uint32_t
+#include <string>   // std::string
+
+namespace {
+
+// wrapper disabling the bitwise comparisons, i.e., forcing the generic std:: algorithms
+template <typename T>
+struct generic {
+    T value;
+
+    friend bool operator==(const generic& lhs, const generic& rhs) { return lhs.value == rhs.value; }
+    friend bool operator<(const generic& lhs, const generic& rhs) { return lhs.value < rhs.value; }
+#if defined(__cpp_impl_three_way_comparison) && defined(__cpp_lib_three_way_comparison)
+    friend std::strong_ordering operator<=>(const generic& lhs, const generic& rhs) { return lhs.value <=> rhs.value; }
+#endif
+};
+
+// compares two arrays whose only mismatch is the last element
+template <typename T>
+void benchmark_comparisons(const std::string& type_name, const std::size_t size) {
+    cpp_util::dynarray<T> lhs(size, T{ 1 });
+    cpp_util::dynarray<T> rhs(size, T{ 1 });
+    rhs.back() = T{ 2 };
+    cpp_util::dynarray<generic<T>> lhs_generic(size, generic<T>{ T{ 1 } });
+    cpp_util::dynarray<generic<T>> rhs_generic(size, generic<T>{ T{ 1 } });
+    rhs_generic.back() = generic<T>{ T{ 2 } };
+
+    BENCHMARK("operator==: " + type_name) {
+        return lhs == rhs;
+    };
+    BENCHMARK("operator== (generic): " + type_name) {
+        return lhs_generic == rhs_generic;
+    };
+    BENCHMARK("operator<: " + type_name) {
+        return lhs < rhs;
+    };
+    BENCHMARK("operator< (generic): " + type_name) {
+        return lhs_generic < rhs_generic;
+    };
+}
+
+}  // namespace
+
+TEST_CASE("dynarray comparison benchmarks", "[comparison]") {
+    constexpr std::size_t size = 1 << 16;
+
+    benchmark_comparisons<std::uint8_t>("std::uint8_t", size);
+    benchmark_comparisons<std::uint32_t>("std::uint32_t", size);
+    benchmark_comparisons<int>("int", size);
+}
@@ -0,0 +1,85 @@
+/**
+ * Copyright (C) 2021 - Marcel Breyer - All Rights Reserved
+ * Licensed under the MIT License. See LICENSE.md file in the project root for full license information.
+ *
+ * Implements benchmarks for the constructors of the cpp_util::dynarray class.
+ * Every element is constructed exactly once compared to the previous default-construct-then-overwrite approach.
+ */
+
+#include "dynarray.hpp"
+
+#include "catch/catch.hpp"
+
+#include <algorithm>  // std::fill, std::copy
+#include <cstddef>    // std::size_t
+#include <memory>     // std::unique_ptr
+#include <string>     // std::string
+#include <vector>     // std::vector
+
+namespace {
+
+// the previous implementation: default construct all elements using new[] and overwrite them afterwards
+template <typename T>
+std::unique_ptr<T[]> construct_then_fill(const std::size_t size, const T& init) {
+    std::unique_ptr<T[]> ptr{ new T[size] };
+    std::fill(ptr.get(), ptr.get() + size, init);
+    return ptr;
+}
+template <typename T>
+std::unique_ptr<T[]> construct_then_copy(const std::vector<T>& vec) {
+    std::unique_ptr<T[]> ptr{ new T[vec.size()] };
+    std::copy(vec.begin(), vec.end(), ptr.get());
+    return ptr;
+}
+
+}  // namespace
+
+TEST_CASE("dynarray construction benchmarks", "[construction]") {
+    constexpr std::size_t int_size = 1 << 24;
+    constexpr std::size_t string_size = 1 << 16;
+    // long enough to disable the small string optimization
+    const std::string long_string(64, 'x');
+
+    BENCHMARK("size + init value constructor: int") {
+        return cpp_util::dynarray<int>(int_size, 42);
+    };
+    BENCHMARK("new[] + std::fill: int") {
+        return construct_then_fill(int_size, 42);
+    };
+
+    BENCHMARK("size + init value constructor: std::string") {
+        return cpp_util::dynarray<std::string>(string_size, long_string);
+    };
+    BENCHMARK("new[] + std::fill: std::string") {
+        return construct_then_fill(string_size, long_string);
+    };
+
+    BENCHMARK("size + for_overwrite constructor: float") {
+        return cpp_util::dynarray<float>(int_size, cpp_util::for_overwrite);
+    };
+    BENCHMARK("size + value_init constructor: float") {
+        return cpp_util::dynarray<float>(int_size, cpp_util::value_init);
+    };
+    BENCHMARK("size + value_init constructor (calloc): float") {
+        return cpp_util::dynarray<float, cpp_util::malloc_allocator<float>>(int_size, cpp_util::value_init);
+    };
+
+    const std::vector<std::string> vec(string_size, long_string);
+
+    BENCHMARK("iterator range constructor: std::string") {
+        return cpp_util::dynarray<std::string>(vec.begin(), vec.end());
+    };
+    BENCHMARK("new[] + std::copy: std::string") {
+        return construct_then_copy(vec);
+    };
+
+    // a buffer handed over by, e.g., a decoder
+    BENCHMARK("adopt std::unique_ptr<float[]>") {
+        std::unique_ptr<float[]> buffer{ new float[int_size]() };
+        return cpp_util::dynarray<float, cpp_util::deleter_allocator<float>>::adopt(buffer.release(), int_size);
+    };
+    BENCHMARK("copy std::unique_ptr<float[]>") {
+        const std::unique_ptr<float[]> buffer{ new float[int_size]() };
+        return cpp_util::dynarray<float>(buffer.get(), buffer.get() + int_size);
+    };
+}
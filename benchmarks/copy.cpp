@@ -0,0 +1,67 @@
+/**
+ * Copyright (C) 2021 - Marcel Breyer - All Rights Reserved
+ * Licensed under the MIT License. See LICENSE.md file in the project root for full license information.
+ *
+ * Implements benchmarks for copying trivially copyable cpp_util::dynarray elements from 64 B up to 1 GiB.
+ * A plain std::memcpy serves as the upper bound, an element-wise copy as the lower bound.
+ */
+
+#include "dynarray.hpp"
+
+#include "catch/catch.hpp"
+
+#include <cstddef>  // std::size_t
+#include <cstring>  // std::memcpy
+#include <list>     // std::list
+#include <memory>   // std::unique_ptr
+#include <string>   // std::string, std::to_string
+#include <vector>   // std::vector
+
+namespace {
+
+std::string format_bytes(const std::size_t bytes) {
+    if (bytes >= (1 << 30)) return std::to_string(bytes >> 30) + " GiB";
+    if (bytes >= (1 << 20)) return std::to_string(bytes >> 20) + " MiB";
+    if (bytes >= (1 << 10)) return std::to_string(bytes >> 10) + " KiB";
+    return std::to_string(bytes) + " B";
+}
+
+}  // namespace
+
+TEST_CASE("dynarray copy benchmarks", "[copy]") {
+    for (std::size_t bytes = 64; bytes <= (std::size_t{ 1 } << 30); bytes *= 64) {
+        const std::size_t size = bytes / sizeof(double);
+        const std::string suffix = ": " + format_bytes(bytes);
+
+        const cpp_util::dynarray<double> arr(size, 42.0);
+
+        BENCHMARK("copy constructor" + suffix) {
+            return cpp_util::dynarray<double>(arr);
+        };
+
+        cpp_util::dynarray<double> target(size, cpp_util::for_overwrite);
+        BENCHMARK("copy-assignment operator" + suffix) {
+            target = arr;
+            return target.data();
+        };
+
+        const std::vector<double> vec(size, 42.0);
+        BENCHMARK("iterator range constructor (std::vector)" + suffix) {
+            return cpp_util::dynarray<double>(vec.data(), vec.data() + vec.size());
+        };
+
+        BENCHMARK("std::memcpy into new storage" + suffix) {
+            std::unique_ptr<double[]> ptr{ new double[size] };
+            std::memcpy(ptr.get(), arr.data(), bytes);
+            return ptr;
+        };
+
+        // a non-contiguous range has to be copied element-wise
+        if (bytes <= (1 << 20)) {
+            const std::list<double> list(size, 42.0);
+            BENCHMARK("iterator range constructor (std::list)" + suffix) {
+                return cpp_util::dynarray<double>(list.begin(), list.end());
+            };
+        }
+    }
+}
@@ -0,0 +1,66 @@
+/**
+ * Copyright (C) 2021 - Marcel Breyer - All Rights Reserved
+ * Licensed under the MIT License. See LICENSE.md file in the project root for full license information.
+ *
+ * Implements benchmarks comparing the cpp_util::jagged_dynarray class with an array of separately allocated rows.
+ * The values of all rows are stored contiguously, i.e., a full scan is sequential.
+ */
+
+#include "dynarray.hpp"
+#include "jagged_dynarray.hpp"
+
+#include "catch/catch.hpp"
+
+#include <cstddef>  // std::size_t
+#include <numeric>  // std::accumulate
+#include <random>   // std::mt19937, std::uniform_int_distribution
+
+namespace {
+
+constexpr std::size_t num_rows = std::size_t{ 1 } << 16;
+
+}  // namespace
+
+TEST_CASE("jagged_dynarray benchmarks", "[jagged_dynarray]") {
+    // random row sizes between 0 and 64
+    std::mt19937 gen{ 42 };
+    std::uniform_int_distribution<std::size_t> dist{ 0, 64 };
+    cpp_util::dynarray<std::size_t> sizes(num_rows, cpp_util::for_overwrite);
+    sizes.generate([&]() { return dist(gen); });
+
+    BENCHMARK("dynarray<dynarray>: construction") {
+        cpp_util::dynarray<cpp_util::dynarray<int>> arr(num_rows);
+        for (std::size_t row = 0; row < num_rows; ++row) {
+            arr[row] = cpp_util::dynarray<int>(sizes[row], 1);
+        }
+        return arr.size();
+    };
+    BENCHMARK("jagged_dynarray: construction") {
+        const cpp_util::jagged_dynarray<int> arr(sizes.begin(), sizes.end(), 1);
+        return arr.size();
+    };
+
+    cpp_util::dynarray<cpp_util::dynarray<int>> nested(num_rows);
+    for (std::size_t row = 0; row < num_rows; ++row) {
+        nested[row] = cpp_util::dynarray<int>(sizes[row], 1);
+    }
+    const cpp_util::jagged_dynarray<int> jagged(sizes.begin(), sizes.end(), 1);
+
+    BENCHMARK("dynarray<dynarray>: row-wise scan") {
+        long long sum = 0;
+        for (const cpp_util::dynarray<int>& row : nested) {
+            sum += std::accumulate(row.begin(), row.end(), 0LL);
+        }
+        return sum;
+    };
+    BENCHMARK("jagged_dynarray: row-wise scan") {
+        long long sum = 0;
+        for (const cpp_util::row_view<const int> row : jagged) {
+            sum += std::accumulate(row.begin(), row.end(), 0LL);
+        }
+        return sum;
+    };
+    BENCHMARK("jagged_dynarray: full scan") {
+        return std::accumulate(jagged.values().begin(), jagged.values().end(), 0LL);
+    };
+}
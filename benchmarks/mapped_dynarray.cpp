@@ -0,0 +1,71 @@
+/**
+ * Copyright (C) 2021 - Marcel Breyer - All Rights Reserved
+ * Licensed under the MIT License. See LICENSE.md file in the project root for full license information.
+ *
+ * Implements benchmarks comparing the time to open a 256 MiB file using cpp_util::mapped_dynarray with reading it using
+ * cpp_util::read_binary (with the file in the page cache, i.e., without disk I/O) and the time to create such a file using a writable
+ * cpp_util::mapped_dynarray with filling a cpp_util::dynarray and writing it using cpp_util::write_binary.
+ */
+
+#include "mapped_dynarray.hpp"
+
+#include "catch/catch.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#include <cstddef>  // std::size_t
+#include <cstdint>  // std::uint64_t
+#include <cstdio>   // std::remove
+#include <string>   // std::string
+
+#include <fcntl.h>   // ::open, O_RDONLY, O_WRONLY, O_TRUNC
+#include <stdlib.h>  // ::mkstemp
+#include <unistd.h>  // ::close
+
+TEST_CASE("mapped_dynarray benchmarks", "[mapped_dynarray]") {
+    constexpr std::size_t size = std::size_t{ 1 } << 25;
+    char name[] = "/tmp/cpp_util_mapped_dynarrayXXXXXX";
+    const int fd = ::mkstemp(name);
+    REQUIRE(fd >= 0);
+    const std::string path = name;
+    {
+        cpp_util::dynarray<std::uint64_t> arr(size);
+        arr.iota();
+        cpp_util::write_binary(fd, arr);
+        ::close(fd);
+    }
+
+    BENCHMARK("read_binary") {
+        const int in = ::open(path.c_str(), O_RDONLY);
+        const auto arr = cpp_util::read_binary<std::uint64_t>(in);
+        ::close(in);
+        return arr[size / 2];
+    };
+    BENCHMARK("mapped_dynarray: open and access one element") {
+        const cpp_util::mapped_dynarray<const std::uint64_t> arr{ path };
+        return arr[size / 2];
+    };
+    BENCHMARK("mapped_dynarray: populate") {
+        const cpp_util::mapped_dynarray<const std::uint64_t> arr{ path, cpp_util::map_prefetch::populate };
+        return arr[size / 2];
+    };
+
+    BENCHMARK("dynarray + write_binary") {
+        cpp_util::dynarray<std::uint64_t> arr(size);
+        arr.iota();
+        const int out = ::open(path.c_str(), O_WRONLY | O_TRUNC);
+        cpp_util::write_binary(out, arr);
+        ::close(out);
+        return arr[size / 2];
+    };
+    BENCHMARK("mapped_dynarray: create, iota, and flush") {
+        cpp_util::mapped_dynarray<std::uint64_t> arr{ path, size };
+        arr.iota();
+        arr.flush();
+        return arr[size / 2];
+    };
+
+    std::remove(path.c_str());
+}
+
+#endif
@@ -0,0 +1,42 @@
+/**
+ * Copyright (C) 2021 - Marcel Breyer - All Rights Reserved
+ * Licensed under the MIT License. See LICENSE.md file in the project root for full license information.
+ *
+ * Implements benchmarks comparing the layouts of the cpp_util::md_dynarray class for a matrix transpose.
+ * With the tiled layout, the column-wise writes of the transpose stay within a few tiles.
+ */
+
+#include "md_dynarray.hpp"
+
+#include "catch/catch.hpp"
+
+#include <array>    // std::array
+#include <cstddef>  // std::size_t
+
+namespace {
+
+constexpr std::size_t extent = 4096;
+
+template <typename Layout>
+float transpose() {
+    using matrix_type = cpp_util::md_dynarray<float, 2, Layout>;
+    static matrix_type in(std::array<std::size_t, 2>{ { extent, extent } }, 1.0f);
+    static matrix_type out(std::array<std::size_t, 2>{ { extent, extent } }, cpp_util::for_overwrite);
+    for (std::size_t i = 0; i < extent; ++i) {
+        for (std::size_t j = 0; j < extent; ++j) {
+            out(j, i) = in(i, j);
+        }
+    }
+    return out(extent - 1, 0);
+}
+
+}  // namespace
+
+TEST_CASE("md_dynarray benchmarks", "[md_dynarray]") {
+    BENCHMARK("row-major: transpose") {
+        return transpose<cpp_util::layout_row_major>();
+    };
+    BENCHMARK("tiled: transpose") {
+        return transpose<cpp_util::layout_tiled<>>();
+    };
+}
@@ -0,0 +1,46 @@
+/**
+ * Copyright (C) 2021 - Marcel Breyer - All Rights Reserved
+ * Licensed under the MIT License. See LICENSE.md file in the project root for full license information.
+ *
+ * Implements benchmarks comparing reading .npy data into a cpp_util::dynarray with parsing the same values from CSV text.
+ */
+
+#include "npy_io.hpp"
+
+#include "catch/catch.hpp"
+
+#include <cstddef>  // std::size_t
+#include <limits>   // std::numeric_limits
+#include <sstream>  // std::stringstream
+#include <string>   // std::string
+
+TEST_CASE("npy serialization benchmarks", "[npy_io]") {
+    constexpr std::size_t size = 1 << 22;
+    cpp_util::dynarray<double> arr(size);
+    arr.iota(0.1);
+
+    std::stringstream csv_stream;
+    csv_stream.precision(std::numeric_limits<double>::max_digits10);
+    for (const double d : arr) {
+        csv_stream << d << ',';
+    }
+    const std::string csv = csv_stream.str();
+
+    std::stringstream npy_stream;
+    cpp_util::write_npy(npy_stream, arr);
+    const std::string npy = npy_stream.str();
+
+    BENCHMARK("parse CSV") {
+        std::stringstream stream{ csv };
+        cpp_util::dynarray<double> read(size);
+        char separator{};
+        for (double& d : read) {
+            stream >> d >> separator;
+        }
+        return read;
+    };
+    BENCHMARK("read_npy") {
+        std::stringstream stream{ npy };
+        return cpp_util::read_npy<double>(stream);
+    };
+}
@@ -0,0 +1,45 @@
+/**
+ * Copyright (C) 2021 - Marcel Breyer - All Rights Reserved
+ * Licensed under the MIT License. See LICENSE.md file in the project root for full license information.
+ *
+ * Implements benchmarks for the serial and parallel fill(), iota(), and generate() member functions of the cpp_util::dynarray class.
+ */
+
+#include "dynarray.hpp"
+
+#include "catch/catch.hpp"
+
+#include <cstddef>  // std::size_t
+
+TEST_CASE("dynarray operations benchmarks", "[operations]") {
+    // 256 MiB
+    cpp_util::dynarray<double> arr(std::size_t{ 1 } << 25, cpp_util::for_overwrite);
+
+    BENCHMARK("fill()") {
+        arr.fill(42.0);
+        return arr.data();
+    };
+    BENCHMARK("parallel fill()") {
+        arr.fill(cpp_util::par, 42.0);
+        return arr.data();
+    };
+
+    BENCHMARK("iota()") {
+        arr.iota(42.0);
+        return arr.data();
+    };
+    BENCHMARK("parallel iota()") {
+        arr.iota(cpp_util::par, 42.0);
+        return arr.data();
+    };
+
+    BENCHMARK("generate()") {
+        std::size_t pos = 0;
+        arr.generate([&]() { return static_cast<double>(pos++) * 0.5; });
+        return arr.data();
+    };
+    BENCHMARK("parallel generate()") {
+        arr.generate(cpp_util::par, [](const std::size_t i) { return static_cast<double>(i) * 0.5; });
+        return arr.data();
+    };
+}
@@ -0,0 +1,53 @@
+/**
+ * Copyright (C) 2021 - Marcel Breyer - All Rights Reserved
+ * Licensed under the MIT License. See LICENSE.md file in the project root for full license information.
+ *
+ * Implements benchmarks comparing many short-lived small cpp_util::dynarrays using std::allocator with cpp_util::pmr::dynarrays
+ * using a std::pmr::monotonic_buffer_resource (an arena released at once).
+ */
+
+#include "dynarray.hpp"
+
+#include "catch/catch.hpp"
+
+#if defined(__cpp_lib_memory_resource)
+
+#include <cstddef>          // std::size_t
+#include <memory_resource>  // std::pmr::monotonic_buffer_resource, std::pmr::unsynchronized_pool_resource
+#include <vector>           // std::pmr::vector
+
+TEST_CASE("pmr dynarray benchmarks", "[pmr]") {
+    constexpr std::size_t num_arrays = 1 << 14;
+    constexpr std::size_t size = 16;
+
+    BENCHMARK("std::allocator") {
+        std::vector<cpp_util::dynarray<int>> arrays;
+        arrays.reserve(num_arrays);
+        for (std::size_t i = 0; i < num_arrays; ++i) {
+            arrays.emplace_back(size, 42);
+        }
+        return arrays.size();
+    };
+
+    BENCHMARK("std::pmr::monotonic_buffer_resource") {
+        std::pmr::monotonic_buffer_resource mr;
+        std::pmr::vector<cpp_util::pmr::dynarray<int>> arrays{ &mr };
+        arrays.reserve(num_arrays);
+        for (std::size_t i = 0; i < num_arrays; ++i) {
+            arrays.emplace_back(size, 42);
+        }
+        return arrays.size();
+    };
+
+    BENCHMARK("std::pmr::unsynchronized_pool_resource") {
+        std::pmr::unsynchronized_pool_resource mr;
+        std::pmr::vector<cpp_util::pmr::dynarray<int>> arrays{ &mr };
+        arrays.reserve(num_arrays);
+        for (std::size_t i = 0; i < num_arrays; ++i) {
+            arrays.emplace_back(size, 42);
+        }
+        return arrays.size();
+    };
+}
+
+#endif
@@ -0,0 +1,68 @@
+/**
+ * Copyright (C) 2021 - Marcel Breyer - All Rights Reserved
+ * Licensed under the MIT License. See LICENSE.md file in the project root for full license information.
+ *
+ * Implements benchmarks for random gathers from a large cpp_util::dynarray using different page backings (see cpp_util::mmap_allocator).
+ * With 4 KiB pages nearly every access misses the TLB, huge pages cover the whole table with far fewer TLB entries.
+ */
+
+#include "dynarray.hpp"
+#include "mmap_allocator.hpp"
+
+#include "catch/catch.hpp"
+
+#include <cstddef>  // std::size_t
+#include <cstdint>  // std::uint64_t, std::uint32_t
+#include <random>   // std::mt19937_64, std::uniform_int_distribution
+
+namespace {
+
+template <typename Array, typename Indices>
+std::uint64_t gather(const Array& table, const Indices& indices) {
+    std::uint64_t sum = 0;
+    for (const std::uint32_t idx : indices) {
+        sum += table[idx];
+    }
+    return sum;
+}
+
+}  // namespace
+
+TEST_CASE("dynarray random gather benchmarks", "[random_gather]") {
+    // 512 MiB table, 1 Mi random indices
+    constexpr std::size_t table_size = std::size_t{ 1 } << 26;
+    constexpr std::size_t num_indices = std::size_t{ 1 } << 20;
+
+    cpp_util::dynarray<std::uint32_t> indices(num_indices, cpp_util::for_overwrite);
+    std::mt19937_64 gen{ 42 };
+    std::uniform_int_distribution<std::uint32_t> dist{ 0, static_cast<std::uint32_t>(table_size - 1) };
+    indices.generate([&]() { return dist(gen); });
+
+    {
+        const cpp_util::dynarray<std::uint64_t> table(table_size, std::uint64_t{ 1 });
+        BENCHMARK("std::allocator") {
+            return gather(table, indices);
+        };
+    }
+    {
+        const cpp_util::huge_page_dynarray<std::uint64_t> table(table_size, std::uint64_t{ 1 },
+                                                                cpp_util::mmap_allocator<std::uint64_t>{ cpp_util::page_backing::normal });
+        BENCHMARK("mmap: normal pages") {
+            return gather(table, indices);
+        };
+    }
+    {
+        const cpp_util::huge_page_dynarray<std::uint64_t> table(
+            table_size, std::uint64_t{ 1 }, cpp_util::mmap_allocator<std::uint64_t>{ cpp_util::page_backing::transparent_huge_pages });
+        BENCHMARK("mmap: transparent huge pages") {
+            return gather(table, indices);
+        };
+    }
+    {
+        const cpp_util::huge_page_dynarray<std::uint64_t> table(
+            table_size, std::uint64_t{ 1 }, cpp_util::mmap_allocator<std::uint64_t>{ cpp_util::page_backing::explicit_huge_pages });
+        BENCHMARK("mmap: MAP_HUGETLB") {
+            return gather(table, indices);
+        };
+    }
+}
@@ -0,0 +1,38 @@
+/**
+ * Copyright (C) 2021 - Marcel Breyer - All Rights Reserved
+ * Licensed under the MIT License. See LICENSE.md file in the project root for full license information.
+ *
+ * Implements benchmarks comparing attaching to a 256 MiB cpp_util::shared_dynarray with copying a cpp_util::dynarray of the same size.
+ */
+
+#include "shared_dynarray.hpp"
+
+#include "catch/catch.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#include <cstddef>  // std::size_t
+#include <string>   // std::string, std::to_string
+
+#include <unistd.h>  // ::getpid
+
+TEST_CASE("shared_dynarray benchmarks", "[shared_dynarray]") {
+    constexpr std::size_t size = std::size_t{ 1 } << 26;
+    const std::string name = "/cpp_util_shared_dynarray_benchmark_" + std::to_string(::getpid());
+
+    cpp_util::dynarray<float> arr(size);
+    arr.iota();
+    cpp_util::shared_dynarray<float> shared = cpp_util::shared_dynarray<float>::create(name, size);
+    shared.iota();
+
+    BENCHMARK("dynarray copy") {
+        const cpp_util::dynarray<float> copy{ arr };
+        return copy[size / 2];
+    };
+    BENCHMARK("shared_dynarray: attach and access one element") {
+        const auto reader = cpp_util::shared_dynarray<const float>::attach(name);
+        return reader[size / 2];
+    };
+}
+
+#endif
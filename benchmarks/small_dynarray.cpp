@@ -0,0 +1,55 @@
+/**
+ * Copyright (C) 2021 - Marcel Breyer - All Rights Reserved
+ * Licensed under the MIT License. See LICENSE.md file in the project root for full license information.
+ *
+ * Implements benchmarks comparing the cpp_util::small_dynarray class with the cpp_util::dynarray class for small sizes.
+ * Up to the inline capacity, no heap allocation is necessary.
+ */
+
+#include "dynarray.hpp"
+#include "small_dynarray.hpp"
+
+#include "catch/catch.hpp"
+
+#include <cstddef>  // std::size_t
+#include <numeric>  // std::accumulate
+#include <string>   // std::to_string
+#include <utility>  // std::move
+
+namespace {
+
+// construct, initialize, and read the array, i.e., a typical short-lived temporary
+template <typename Array>
+int construct_and_sum(const std::size_t size) {
+    Array arr(size, cpp_util::for_overwrite);
+    arr.iota(1);
+    return std::accumulate(arr.begin(), arr.end(), 0);
+}
+
+}  // namespace
+
+TEST_CASE("small_dynarray benchmarks", "[small_dynarray]") {
+    for (const std::size_t size : { std::size_t{ 1 }, std::size_t{ 4 }, std::size_t{ 16 }, std::size_t{ 64 } }) {
+        BENCHMARK("dynarray: " + std::to_string(size) + " elements") {
+            return construct_and_sum<cpp_util::dynarray<int>>(size);
+        };
+        BENCHMARK("small_dynarray<16>: " + std::to_string(size) + " elements") {
+            return construct_and_sum<cpp_util::small_dynarray<int, 16>>(size);
+        };
+    }
+
+    for (const std::size_t size : { std::size_t{ 4 }, std::size_t{ 64 } }) {
+        cpp_util::dynarray<int> arr(size, 42);
+        cpp_util::small_dynarray<int, 16> small_arr(size, 42);
+        BENCHMARK("dynarray move: " + std::to_string(size) + " elements") {
+            cpp_util::dynarray<int> tmp{ std::move(arr) };
+            arr = std::move(tmp);
+            return arr.data();
+        };
+        BENCHMARK("small_dynarray<16> move: " + std::to_string(size) + " elements") {
+            cpp_util::small_dynarray<int, 16> tmp{ std::move(small_arr) };
+            small_arr = std::move(tmp);
+            return small_arr.data();
+        };
+    }
+}
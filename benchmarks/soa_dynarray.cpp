@@ -0,0 +1,59 @@
+/**
+ * Copyright (C) 2021 - Marcel Breyer - All Rights Reserved
+ * Licensed under the MIT License. See LICENSE.md file in the project root for full license information.
+ *
+ * Implements benchmarks comparing the cpp_util::soa_dynarray class with a cpp_util::dynarray of structs for loops touching a single field.
+ * Only the cache lines of the used field are loaded from memory.
+ */
+
+#include "dynarray.hpp"
+#include "soa_dynarray.hpp"
+
+#include "catch/catch.hpp"
+
+#include <cstddef>  // std::size_t
+#include <numeric>  // std::accumulate
+
+namespace {
+
+constexpr std::size_t num_particles = std::size_t{ 1 } << 22;
+
+struct particle {
+    float x{ 1.0f };
+    float y{ 2.0f };
+    float z{ 3.0f };
+    int id{ 0 };
+};
+
+}  // namespace
+
+TEST_CASE("soa_dynarray benchmarks", "[soa_dynarray]") {
+    cpp_util::dynarray<particle> aos(num_particles);
+    cpp_util::soa_dynarray<float, float, float, int> soa(num_particles);
+    soa.field<0>().fill(1.0f);
+
+    BENCHMARK("dynarray<particle>: sum x") {
+        float sum = 0.0f;
+        for (const particle& p : aos) {
+            sum += p.x;
+        }
+        return sum;
+    };
+    BENCHMARK("soa_dynarray: sum x") {
+        const cpp_util::row_view<float> x = soa.field<0>();
+        return std::accumulate(x.begin(), x.end(), 0.0f);
+    };
+
+    BENCHMARK("dynarray<particle>: move x") {
+        for (particle& p : aos) {
+            p.x += 0.5f;
+        }
+        return aos.data();
+    };
+    BENCHMARK("soa_dynarray: move x") {
+        for (float& x : soa.field<0>()) {
+            x += 0.5f;
+        }
+        return soa.data<0>();
+    };
+}
@@ -0,0 +1,43 @@
+/**
+ * Copyright (C) 2021 - Marcel Breyer - All Rights Reserved
+ * Licensed under the MIT License. See LICENSE.md file in the project root for full license information.
+ *
+ * Implements benchmarks comparing the cpp_util::static_dynarray class with the cpp_util::dynarray class for small, fixed sizes.
+ * With a compile-time size, the loops have a constant trip count and can be fully unrolled.
+ */
+
+#include "dynarray.hpp"
+#include "static_dynarray.hpp"
+
+#include "catch/catch.hpp"
+
+#include <cstddef>  // std::size_t
+
+namespace {
+
+constexpr std::size_t extent = 16;
+constexpr std::size_t num_arrays = 1 << 14;
+
+}  // namespace
+
+TEST_CASE("static_dynarray benchmarks", "[static_dynarray]") {
+    cpp_util::dynarray<cpp_util::dynarray<float>> dynamic_arrays(num_arrays, cpp_util::dynarray<float>(extent));
+    cpp_util::dynarray<cpp_util::static_dynarray<float, extent>> static_arrays(num_arrays);
+
+    BENCHMARK("dynarray: fill and compare") {
+        std::size_t equal = 0;
+        for (std::size_t i = 0; i < num_arrays; ++i) {
+            dynamic_arrays[i].fill(static_cast<float>(i % 2));
+            equal += dynamic_arrays[i] == dynamic_arrays[0];
+        }
+        return equal;
+    };
+    BENCHMARK("static_dynarray: fill and compare") {
+        std::size_t equal = 0;
+        for (std::size_t i = 0; i < num_arrays; ++i) {
+            static_arrays[i].fill(static_cast<float>(i % 2));
+            equal += static_arrays[i] == static_arrays[0];
+        }
+        return equal;
+    };
+}
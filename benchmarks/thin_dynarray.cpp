@@ -0,0 +1,90 @@
+/**
+ * Copyright (C) 2021 - Marcel Breyer - All Rights Reserved
+ * Licensed under the MIT License. See LICENSE.md file in the project root for full license information.
+ *
+ * Implements benchmarks comparing the memory footprint of the cpp_util::thin_dynarray class with the cpp_util::dynarray class and std::vector.
+ * The heap usage is measured using mallinfo2 (glibc >= 2.33 only), otherwise only the handle sizes are reported.
+ */
+
+#include "dynarray.hpp"
+#include "thin_dynarray.hpp"
+
+#include "catch/catch.hpp"
+
+#include <cstddef>   // std::size_t
+#include <iostream>  // std::cout
+#include <string>    // std::string
+#include <vector>    // std::vector
+
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+#include <malloc.h>  // mallinfo2
+#define CPP_UTIL_HAS_MALLINFO2
+#endif
+
+namespace {
+
+constexpr std::size_t num_handles = std::size_t{ 1 } << 20;
+
+std::size_t heap_usage() {
+#if defined(CPP_UTIL_HAS_MALLINFO2)
+    return mallinfo2().uordblks;
+#else
+    return 0;
+#endif
+}
+
+// the total number of bytes per handle (including the elements and the malloc overhead) for many small arrays
+template <typename Array>
+void report_footprint(const std::string& name, const std::size_t num_elements) {
+    const std::size_t before = heap_usage();
+    {
+        std::vector<Array> handles;
+        handles.reserve(num_handles);
+        for (std::size_t i = 0; i < num_handles; ++i) {
+            handles.emplace_back(num_elements, 42);
+        }
+        const std::size_t after = heap_usage();
+        std::cout << name << " (" << num_elements << " elements): sizeof = " << sizeof(Array);
+        if (after != before) {
+            std::cout << " B, footprint = " << static_cast<double>(after - before) / num_handles << " B per array\n";
+        } else {
+            std::cout << " B\n";
+        }
+    }
+}
+
+}  // namespace
+
+TEST_CASE("thin_dynarray benchmarks", "[thin_dynarray]") {
+    for (const std::size_t num_elements : { std::size_t{ 0 }, std::size_t{ 1 }, std::size_t{ 4 } }) {
+        report_footprint<cpp_util::thin_dynarray<int>>("thin_dynarray", num_elements);
+        report_footprint<cpp_util::dynarray<int>>("dynarray", num_elements);
+        report_footprint<std::vector<int>>("std::vector", num_elements);
+    }
+
+    // accessing the size requires a dereference
+    const cpp_util::thin_dynarray<int> thin_arr(1024, 1);
+    const cpp_util::dynarray<int> arr(1024, 1);
+    BENCHMARK("thin_dynarray: construction") {
+        return cpp_util::thin_dynarray<int>(4, 42);
+    };
+    BENCHMARK("dynarray: construction") {
+        return cpp_util::dynarray<int>(4, 42);
+    };
+    BENCHMARK("thin_dynarray: sum") {
+        int sum = 0;
+        for (const int i : thin_arr) {
+            sum += i;
+        }
+        return sum;
+    };
+    BENCHMARK("dynarray: sum") {
+        int sum = 0;
+        for (const int i : arr) {
+            sum += i;
+        }
+        return sum;
+    };
+}
+
+#undef CPP_UTIL_HAS_MALLINFO2
@@ -0,0 +1,330 @@
+/**
+ * Copyright (C) 2021 - Marcel Breyer - All Rights Reserved
+ * Licensed under the MIT License. See LICENSE.md file in the project root for full license information.
+ *
+ * Implements the binary serialization and deserialization of cpp_util::dynarray with trivially copyable elements.
+ */
+
+#ifndef CPP_UTIL_BINARY_IO_HPP
+#define CPP_UTIL_BINARY_IO_HPP
+
+#include "dynarray.hpp"
+
+#include <cstddef>      // std::size_t
+#include <cstdint>      // std::uint32_t, std::uint64_t, std::uintmax_t
+#include <cstring>      // std::memcpy, std::memcmp
+#include <istream>      // std::istream
+#include <memory>       // std::allocator
+#include <ostream>      // std::ostream
+#include <stdexcept>    // std::runtime_error, std::length_error
+#include <type_traits>  // std::is_trivially_copyable, std::is_arithmetic
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <cerrno>        // errno, EINTR
+#include <system_error>  // std::system_error, std::generic_category
+#include <unistd.h>      // ::read, ::write
+#define DYNARRAY_HAS_POSIX_IO
+#endif
+
+namespace cpp_util {
+
+namespace detail {
+
+/**
+ * @brief The 64 byte header preceding the elements in the binary format. All fields are stored in the byte order of the writer,
+ *        which is identified by @p byte_order. The elements directly follow the header, i.e., they are aligned to a cache line
+ *        relative to the start of the file.
+ */
+struct binary_header {
+  char magic[8];
+  std::uint32_t byte_order;
+  std::uint32_t version;
+  std::uint64_t element_size;
+  std::uint64_t count;
+  // XXH64 (with seed 0) of the elements as stored
+  std::uint64_t checksum;
+  unsigned char reserved[24];
+};
+static_assert(sizeof(binary_header) == 64, "The binary header must be exactly 64 bytes large");
+
+DYNARRAY_INLINE_VARIABLE constexpr char binary_magic[8] = { 'D', 'Y', 'N', 'A', 'R', 'R', 'A', 'Y' };
+DYNARRAY_INLINE_VARIABLE constexpr std::uint32_t binary_byte_order = 0x01020304;
+DYNARRAY_INLINE_VARIABLE constexpr std::uint32_t binary_version = 1;
+
+template <typename T>
+T byteswap(T value) noexcept {
+  unsigned char bytes[sizeof(T)];
+  std::memcpy(bytes, &value, sizeof(T));
+  for (std::size_t i = 0; i < sizeof(T) / 2; ++i) {
+    const unsigned char tmp = bytes[i];
+    bytes[i] = bytes[sizeof(T) - 1 - i];
+    bytes[sizeof(T) - 1 - i] = tmp;
+  }
+  std::memcpy(&value, bytes, sizeof(T));
+  return value;
+}
+
+/**
+ * @brief The 64-bit xxHash (XXH64) of @p size bytes. Four independent accumulators consume 32 bytes per iteration,
+ *        i.e., the checksum is computed at memory bandwidth instead of byte by byte.
+ */
+class xxh64 {
+ public:
+  DYNARRAY_NODISCARD static std::uint64_t hash(const void* data, const std::size_t size) noexcept {
+    const unsigned char* ptr = static_cast<const unsigned char*>(data);
+    const unsigned char* const last = ptr + size;
+    std::uint64_t h = 0;
+
+    if (size >= 32) {
+      std::uint64_t v1 = prime1 + prime2;
+      std::uint64_t v2 = prime2;
+      std::uint64_t v3 = 0;
+      std::uint64_t v4 = 0 - prime1;
+      for (; last - ptr >= 32; ptr += 32) {
+        v1 = round(v1, read64(ptr));
+        v2 = round(v2, read64(ptr + 8));
+        v3 = round(v3, read64(ptr + 16));
+        v4 = round(v4, read64(ptr + 24));
+      }
+      h = rotl(v1, 1) + rotl(v2, 7) + rotl(v3, 12) + rotl(v4, 18);
+      h = merge(h, v1);
+      h = merge(h, v2);
+      h = merge(h, v3);
+      h = merge(h, v4);
+    } else {
+      h = prime5;
+    }
+    h += static_cast<std::uint64_t>(size);
+
+    for (; last - ptr >= 8; ptr += 8) {
+      h ^= round(0, read64(ptr));
+      h = rotl(h, 27) * prime1 + prime4;
+    }
+    if (last - ptr >= 4) {
+      h ^= static_cast<std::uint64_t>(read32(ptr)) * prime1;
+      h = rotl(h, 23) * prime2 + prime3;
+      ptr += 4;
+    }
+    for (; ptr != last; ++ptr) {
+      h ^= *ptr * prime5;
+      h = rotl(h, 11) * prime1;
+    }
+
+    h ^= h >> 33;
+    h *= prime2;
+    h ^= h >> 29;
+    h *= prime3;
+    h ^= h >> 32;
+    return h;
+  }
+
+ private:
+  static constexpr std::uint64_t prime1 = 0x9E3779B185EBCA87ull;
+  static constexpr std::uint64_t prime2 = 0xC2B2AE3D27D4EB4Full;
+  static constexpr std::uint64_t prime3 = 0x165667B19E3779F9ull;
+  static constexpr std::uint64_t prime4 = 0x85EBCA77C2B2AE63ull;
+  static constexpr std::uint64_t prime5 = 0x27D4EB2F165667C5ull;
+
+  static std::uint64_t rotl(const std::uint64_t x, const int r) noexcept { return (x << r) | (x >> (64 - r)); }
+  static std::uint64_t round(std::uint64_t acc, const std::uint64_t input) noexcept {
+    acc += input * prime2;
+    return rotl(acc, 31) * prime1;
+  }
+  static std::uint64_t merge(std::uint64_t acc, const std::uint64_t value) noexcept {
+    acc ^= round(0, value);
+    return acc * prime1 + prime4;
+  }
+  // XXH64 is defined on little-endian words
+  template <typename Word>
+  static Word read_le(const unsigned char* ptr) noexcept {
+    Word word;
+    std::memcpy(&word, ptr, sizeof(Word));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    word = byteswap(word);
+#endif
+    return word;
+  }
+  static std::uint64_t read64(const unsigned char* ptr) noexcept { return read_le<std::uint64_t>(ptr); }
+  static std::uint32_t read32(const unsigned char* ptr) noexcept { return read_le<std::uint32_t>(ptr); }
+};
+
+template <typename T>
+binary_header make_binary_header(const T* data, const std::size_t count) noexcept {
+  binary_header header{};
+  std::memcpy(header.magic, binary_magic, sizeof(binary_magic));
+  header.byte_order = binary_byte_order;
+  header.version = binary_version;
+  header.element_size = sizeof(T);
+  header.count = count;
+  header.checksum = xxh64::hash(data, count * sizeof(T));
+  return header;
+}
+
+/**
+ * @brief Checks that @p header describes elements of type T (and converts it to the native byte order).
+ * @return `true` if the elements have been written using the opposite byte order
+ * @throws std::runtime_error if @p header isn't a valid header or describes elements of a different size
+ */
+template <typename T>
+bool check_binary_header(binary_header& header) {
+  if (std::memcmp(header.magic, binary_magic, sizeof(binary_magic)) != 0) {
+    throw std::runtime_error{ "Invalid cpp_util::dynarray binary header" };
+  }
+  const bool swapped = header.byte_order != binary_byte_order;
+  if (swapped) {
+    if (byteswap(header.byte_order) != binary_byte_order) {
+      throw std::runtime_error{ "Invalid cpp_util::dynarray binary header" };
+    }
+    header.version = byteswap(header.version);
+    header.element_size = byteswap(header.element_size);
+    header.count = byteswap(header.count);
+    header.checksum = byteswap(header.checksum);
+  }
+  if (header.version != binary_version) {
+    throw std::runtime_error{ "Unsupported cpp_util::dynarray binary format version" };
+  }
+  if (header.element_size != sizeof(T)) {
+    throw std::runtime_error{ "The element size of the cpp_util::dynarray binary data doesn't match sizeof(T)" };
+  }
+  return swapped;
+}
+
+// the elements are stored in the opposite byte order: swap them or (for non-arithmetic types) fail
+template <typename T>
+void byteswap_elements(T* data, const std::size_t count, std::true_type) noexcept {
+  for (std::size_t i = 0; i < count; ++i) {
+    data[i] = byteswap(data[i]);
+  }
+}
+template <typename T>
+void byteswap_elements(T*, std::size_t, std::false_type) {
+  throw std::runtime_error{ "Can't convert the byte order of non-arithmetic cpp_util::dynarray elements" };
+}
+
+template <typename T, typename Allocator, typename SizeType>
+dynarray<T, Allocator, SizeType> allocate_binary(const binary_header& header, const Allocator& alloc) {
+  using array_type = dynarray<T, Allocator, SizeType>;
+  if (header.count > static_cast<std::uintmax_t>(array_type::max_size())) {
+    throw std::length_error{ "The number of elements of the cpp_util::dynarray binary data exceeds max_size()" };
+  }
+  // the elements are overwritten by the payload anyways
+  return array_type(static_cast<SizeType>(header.count), for_overwrite, alloc);
+}
+
+template <typename T>
+void finish_binary_read(const binary_header& header, T* data, const std::size_t count, const bool swapped) {
+  if (xxh64::hash(data, count * sizeof(T)) != header.checksum) {
+    throw std::runtime_error{ "Checksum mismatch of the cpp_util::dynarray binary data" };
+  }
+  if (swapped) {
+    byteswap_elements(data, count, std::is_arithmetic<T>{});
+  }
+}
+
+#if defined(DYNARRAY_HAS_POSIX_IO)
+// ::read and ::write may transfer fewer bytes than requested (at most about 2 GiB on Linux)
+inline void write_all(const int fd, const void* data, std::size_t size) {
+  const char* ptr = static_cast<const char*>(data);
+  while (size > 0) {
+    const ::ssize_t written = ::write(fd, ptr, size);
+    if (written < 0) {
+      if (errno == EINTR) continue;
+      throw std::system_error{ errno, std::generic_category(), "Failed to write the cpp_util::dynarray binary data" };
+    }
+    ptr += written;
+    size -= static_cast<std::size_t>(written);
+  }
+}
+inline void read_all(const int fd, void* data, std::size_t size) {
+  char* ptr = static_cast<char*>(data);
+  while (size > 0) {
+    const ::ssize_t bytes = ::read(fd, ptr, size);
+    if (bytes < 0) {
+      if (errno == EINTR) continue;
+      throw std::system_error{ errno, std::generic_category(), "Failed to read the cpp_util::dynarray binary data" };
+    }
+    if (bytes == 0) {
+      throw std::runtime_error{ "Unexpected end of the cpp_util::dynarray binary data" };
+    }
+    ptr += bytes;
+    size -= static_cast<std::size_t>(bytes);
+  }
+}
+#endif
+
+}  // namespace detail
+
+/**
+ * @brief Writes the header (element size, count, byte order, and checksum) followed by the elements of @p arr using a single bulk write.
+ * @throws std::runtime_error if writing fails
+ */
+template <typename T, typename Allocator, typename SizeType>
+void write_binary(std::ostream& out, const dynarray<T, Allocator, SizeType>& arr) {
+  static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable elements can be written in the binary format");
+  const detail::binary_header header = detail::make_binary_header(arr.data(), arr.size());
+  out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  out.write(reinterpret_cast<const char*>(arr.data()), static_cast<std::streamsize>(arr.size() * sizeof(T)));
+  if (!out) {
+    throw std::runtime_error{ "Failed to write the cpp_util::dynarray binary data" };
+  }
+}
+
+/**
+ * @brief Reads a cpp_util::dynarray written by cpp_util::write_binary using a single allocation (without initializing the elements) and
+ *        a single bulk read. Arithmetic elements written on a machine with the opposite byte order are converted.
+ * @throws std::runtime_error if reading fails, the header doesn't match @p T, or the checksum doesn't match
+ * @throws std::length_error if the number of elements exceeds the max_size() of the cpp_util::dynarray
+ */
+template <typename T, typename Allocator = std::allocator<T>, typename SizeType = std::size_t>
+DYNARRAY_NODISCARD dynarray<T, Allocator, SizeType> read_binary(std::istream& in, const Allocator& alloc = Allocator()) {
+  static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable elements can be read from the binary format");
+  detail::binary_header header{};
+  if (!in.read(reinterpret_cast<char*>(&header), sizeof(header))) {
+    throw std::runtime_error{ "Failed to read the cpp_util::dynarray binary header" };
+  }
+  const bool swapped = detail::check_binary_header<T>(header);
+  dynarray<T, Allocator, SizeType> arr = detail::allocate_binary<T, Allocator, SizeType>(header, alloc);
+  if (!in.read(reinterpret_cast<char*>(arr.data()), static_cast<std::streamsize>(arr.size() * sizeof(T)))) {
+    throw std::runtime_error{ "Failed to read the cpp_util::dynarray binary data" };
+  }
+  detail::finish_binary_read(header, arr.data(), arr.size(), swapped);
+  return arr;
+}
+
+#if defined(DYNARRAY_HAS_POSIX_IO)
+/**
+ * @brief Writes @p arr in the binary format to the file descriptor @p fd bypassing the stream buffers.
+ * @throws std::system_error if writing fails
+ */
+template <typename T, typename Allocator, typename SizeType>
+void write_binary(const int fd, const dynarray<T, Allocator, SizeType>& arr) {
+  static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable elements can be written in the binary format");
+  const detail::binary_header header = detail::make_binary_header(arr.data(), arr.size());
+  detail::write_all(fd, &header, sizeof(header));
+  detail::write_all(fd, arr.data(), arr.size() * sizeof(T));
+}
+
+/**
+ * @brief Reads a cpp_util::dynarray in the binary format from the file descriptor @p fd bypassing the stream buffers.
+ * @throws std::system_error if reading fails
+ * @throws std::runtime_error if the data ends prematurely, the header doesn't match @p T, or the checksum doesn't match
+ * @throws std::length_error if the number of elements exceeds the max_size() of the cpp_util::dynarray
+ */
+template <typename T, typename Allocator = std::allocator<T>, typename SizeType = std::size_t>
+DYNARRAY_NODISCARD dynarray<T, Allocator, SizeType> read_binary(const int fd, const Allocator& alloc = Allocator()) {
+  static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable elements can be read from the binary format");
+  detail::binary_header header{};
+  detail::read_all(fd, &header, sizeof(header));
+  const bool swapped = detail::check_binary_header<T>(header);
+  dynarray<T, Allocator, SizeType> arr = detail::allocate_binary<T, Allocator, SizeType>(header, alloc);
+  detail::read_all(fd, arr.data(), arr.size() * sizeof(T));
+  detail::finish_binary_read(header, arr.data(), arr.size(), swapped);
+  return arr;
+}
+#endif
+
+}  // namespace cpp_util
+
+#undef DYNARRAY_HAS_POSIX_IO
+
+#endif  // CPP_UTIL_BINARY_IO_HPP
@@ -0,0 +1,379 @@
+/**
+ * Copyright (C) 2021 - Marcel Breyer - All Rights Reserved
+ * Licensed under the MIT License. See LICENSE.md file in the project root for full license information.
+ *
+ * Implements a runtime fixed-size array of bits packed into 64-bit words.
+ */
+
+#ifndef CPP_UTIL_BIT_DYNARRAY_HPP
+#define CPP_UTIL_BIT_DYNARRAY_HPP
+
+#include "dynarray.hpp"
+
+#include <cassert>           // assert
+#include <cstddef>           // std::size_t, std::ptrdiff_t
+#include <cstdint>           // std::uint64_t
+#include <initializer_list>  // std::initializer_list
+#include <iterator>          // std::forward_iterator_tag
+#include <limits>            // std::numeric_limits
+#include <memory>            // std::allocator
+#include <stdexcept>         // std::out_of_range
+#include <type_traits>       // std::is_same, std::is_nothrow_move_assignable
+#include <utility>           // std::move, std::swap
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>  // __popcnt64
+#endif
+
+namespace cpp_util {
+
+namespace detail {
+
+/**
+ * @brief Returns the number of set bits in @p x. With the matching target flags (e.g., `-mpopcnt` or `-march=native`), the compiler builtin
+ *        results in a single popcnt instruction.
+ */
+inline int popcount(const std::uint64_t x) noexcept {
+#if defined(__cpp_lib_bitops)
+  return std::popcount(x);
+#elif defined(__GNUC__) || defined(__clang__)
+  return __builtin_popcountll(x);
+#elif defined(_MSC_VER) && defined(_M_X64)
+  return static_cast<int>(__popcnt64(x));
+#else
+  std::uint64_t val = x - ((x >> 1) & 0x5555555555555555ull);
+  val = (val & 0x3333333333333333ull) + ((val >> 2) & 0x3333333333333333ull);
+  val = (val + (val >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+  return static_cast<int>((val * 0x0101010101010101ull) >> 56);
+#endif
+}
+
+}  // namespace detail
+
+/**
+ * @brief A runtime fixed-size array of bools using a single bit per element, i.e., the bits are packed into the 64-bit words of a
+ *        cpp_util::dynarray. All operations (fill, count, find, bitwise operators) work on whole words; the unused bits of the last word
+ *        are always zero.
+ */
+template <typename Allocator = std::allocator<std::uint64_t>>
+class bit_dynarray {
+ public:
+  /**************************************************************************************************************************************/
+  /**                                                              types                                                               **/
+  /**************************************************************************************************************************************/
+  using value_type = bool;
+  using word_type = std::uint64_t;
+  using allocator_type = Allocator;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using const_reference = bool;
+
+  static_assert(std::is_same<typename allocator_type::value_type, word_type>::value,
+                "cpp_util::bit_dynarray requires an allocator of std::uint64_t words");
+
+  static constexpr size_type bits_per_word() noexcept { return std::numeric_limits<word_type>::digits; }
+
+  /**
+   * @brief Proxy reference to a single bit.
+   */
+  class reference {
+   public:
+    reference(word_type& word, const word_type mask) noexcept : word_{ &word }, mask_{ mask } {}
+
+    reference& operator=(const bool value) noexcept {
+      *word_ = value ? (*word_ | mask_) : (*word_ & ~mask_);
+      return *this;
+    }
+    reference& operator=(const reference& other) noexcept { return *this = static_cast<bool>(other); }
+    operator bool() const noexcept { return (*word_ & mask_) != 0; }
+    void flip() noexcept { *word_ ^= mask_; }
+
+   private:
+    word_type* word_;
+    word_type mask_;
+  };
+
+  /**
+   * @brief Forward iterator over the positions of the set bits (in increasing order).
+   */
+  class set_bit_iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = size_type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const size_type*;
+    using reference = size_type;
+
+    set_bit_iterator() = default;
+    set_bit_iterator(const word_type* words, const size_type num_words, const size_type word_idx) noexcept
+        : words_{ words }, num_words_{ num_words }, word_idx_{ word_idx }, word_{ word_idx < num_words ? words[word_idx] : 0 } {
+      this->skip_zero_words();
+    }
+
+    DYNARRAY_NODISCARD reference operator*() const noexcept {
+      return word_idx_ * bits_per_word() + static_cast<size_type>(detail::countr_zero(word_));
+    }
+    set_bit_iterator& operator++() noexcept {
+      // clear the lowest set bit
+      word_ &= word_ - 1;
+      this->skip_zero_words();
+      return *this;
+    }
+    set_bit_iterator operator++(int) noexcept {
+      set_bit_iterator tmp{ *this };
+      ++*this;
+      return tmp;
+    }
+
+    DYNARRAY_NODISCARD friend bool operator==(const set_bit_iterator& lhs, const set_bit_iterator& rhs) noexcept {
+      return lhs.word_idx_ == rhs.word_idx_ && lhs.word_ == rhs.word_;
+    }
+    DYNARRAY_NODISCARD friend bool operator!=(const set_bit_iterator& lhs, const set_bit_iterator& rhs) noexcept { return !(lhs == rhs); }
+
+   private:
+    void skip_zero_words() noexcept {
+      while (word_ == 0 && word_idx_ < num_words_) {
+        ++word_idx_;
+        word_ = word_idx_ < num_words_ ? words_[word_idx_] : 0;
+      }
+    }
+
+    const word_type* words_{ nullptr };
+    size_type num_words_{ 0 };
+    size_type word_idx_{ 0 };
+    word_type word_{ 0 };
+  };
+
+  /**
+   * @brief The range of the positions of all set bits, e.g., `for (const std::size_t pos : arr.set_bits()) { ... }`.
+   */
+  class set_bits_range {
+   public:
+    set_bits_range(const word_type* words, const size_type num_words) noexcept : words_{ words }, num_words_{ num_words } {}
+
+    DYNARRAY_NODISCARD set_bit_iterator begin() const noexcept { return set_bit_iterator{ words_, num_words_, 0 }; }
+    DYNARRAY_NODISCARD set_bit_iterator end() const noexcept { return set_bit_iterator{ words_, num_words_, num_words_ }; }
+
+   private:
+    const word_type* words_;
+    size_type num_words_;
+  };
+
+  /**************************************************************************************************************************************/
+  /**                                                           construction                                                           **/
+  /**************************************************************************************************************************************/
+  bit_dynarray() : bit_dynarray(allocator_type()) {}
+  explicit bit_dynarray(const allocator_type& alloc) : words_(alloc) {}
+  // all bits are initially unset
+  explicit bit_dynarray(const size_type size, const allocator_type& alloc = allocator_type())
+      : words_(num_words_for(size), value_init, alloc), size_{ size } {}
+  bit_dynarray(const size_type size, const bool value, const allocator_type& alloc = allocator_type())
+      : words_(num_words_for(size), value ? ~word_type{ 0 } : word_type{ 0 }, alloc), size_{ size } {
+    this->clear_unused_bits();
+  }
+  // the bits are left uninitialized
+  bit_dynarray(const size_type size, for_overwrite_t, const allocator_type& alloc = allocator_type())
+      : words_(num_words_for(size), for_overwrite, alloc), size_{ size } {
+    this->clear_unused_bits();
+  }
+  bit_dynarray(std::initializer_list<bool> ilist, const allocator_type& alloc = allocator_type()) : bit_dynarray(ilist.size(), alloc) {
+    size_type pos = 0;
+    for (const bool value : ilist) {
+      this->set(pos++, value);
+    }
+  }
+  bit_dynarray(const bit_dynarray&) = default;
+  bit_dynarray(bit_dynarray&& other) noexcept : words_(std::move(other.words_)), size_{ detail::exchange(other.size_, size_type{ 0 }) } {}
+
+  /**************************************************************************************************************************************/
+  /**                                                            assignment                                                            **/
+  /**************************************************************************************************************************************/
+  bit_dynarray& operator=(const bit_dynarray&) = default;
+  bit_dynarray& operator=(bit_dynarray&& rhs) noexcept(std::is_nothrow_move_assignable<dynarray<word_type, allocator_type>>::value) {
+    words_ = std::move(rhs.words_);
+    size_ = rhs.size_;
+    // with unequal, non-propagating allocators the words are moved one by one and rhs keeps its own
+    if (rhs.words_.empty()) {
+      rhs.size_ = 0;
+    }
+    return *this;
+  }
+
+  DYNARRAY_NODISCARD allocator_type get_allocator() const noexcept { return words_.get_allocator(); }
+
+  /**************************************************************************************************************************************/
+  /**                                                          element access                                                          **/
+  /**************************************************************************************************************************************/
+  DYNARRAY_NODISCARD reference at(const size_type pos) {
+    if (pos >= size_) throw std::out_of_range{ "Index out-of-range: pos >= this->size()" };
+    return (*this)[pos];
+  }
+  DYNARRAY_NODISCARD const_reference at(const size_type pos) const {
+    if (pos >= size_) throw std::out_of_range{ "Index out-of-range: pos >= this->size()" };
+    return (*this)[pos];
+  }
+  DYNARRAY_NODISCARD reference operator[](const size_type pos) {
+    assert((pos < this->size()) && "Undefined behavior if pos >= this->size()!");
+    return reference{ words_[pos / bits_per_word()], bit_mask(pos) };
+  }
+  DYNARRAY_NODISCARD const_reference operator[](const size_type pos) const { return this->test(pos); }
+  DYNARRAY_NODISCARD bool test(const size_type pos) const noexcept {
+    assert((pos < this->size()) && "Undefined behavior if pos >= this->size()!");
+    return (words_[pos / bits_per_word()] & bit_mask(pos)) != 0;
+  }
+  void set(const size_type pos) noexcept {
+    assert((pos < this->size()) && "Undefined behavior if pos >= this->size()!");
+    words_[pos / bits_per_word()] |= bit_mask(pos);
+  }
+  void set(const size_type pos, const bool value) noexcept { value ? this->set(pos) : this->reset(pos); }
+  void reset(const size_type pos) noexcept {
+    assert((pos < this->size()) && "Undefined behavior if pos >= this->size()!");
+    words_[pos / bits_per_word()] &= ~bit_mask(pos);
+  }
+  void flip(const size_type pos) noexcept {
+    assert((pos < this->size()) && "Undefined behavior if pos >= this->size()!");
+    words_[pos / bits_per_word()] ^= bit_mask(pos);
+  }
+  // the underlying words: bit i is stored in bit (i % 64) of word (i / 64)
+  DYNARRAY_NODISCARD word_type* words() noexcept { return words_.data(); }
+  DYNARRAY_NODISCARD const word_type* words() const noexcept { return words_.data(); }
+  DYNARRAY_NODISCARD size_type num_words() const noexcept { return words_.size(); }
+
+  /**************************************************************************************************************************************/
+  /**                                                             capacity                                                             **/
+  /**************************************************************************************************************************************/
+  DYNARRAY_NODISCARD bool empty() const noexcept { return size_ == 0; }
+  DYNARRAY_NODISCARD size_type size() const noexcept { return size_; }
+  DYNARRAY_NODISCARD static constexpr size_type max_size() noexcept { return std::numeric_limits<size_type>::max() - bits_per_word(); }
+
+  /**************************************************************************************************************************************/
+  /**                                                            operations                                                            **/
+  /**************************************************************************************************************************************/
+  void swap(bit_dynarray& other) noexcept {
+    words_.swap(other.words_);
+    std::swap(size_, other.size_);
+  }
+  void fill(const bool value) {
+    if (!words_.empty()) {
+      words_.fill(value ? ~word_type{ 0 } : word_type{ 0 });
+      this->clear_unused_bits();
+    }
+  }
+  void fill(const parallel_policy& policy, const bool value) {
+    if (!words_.empty()) {
+      words_.fill(policy, value ? ~word_type{ 0 } : word_type{ 0 });
+      this->clear_unused_bits();
+    }
+  }
+  void set() { this->fill(true); }
+  void reset() { this->fill(false); }
+  void flip() noexcept {
+    for (word_type& word : words_) {
+      word = ~word;
+    }
+    this->clear_unused_bits();
+  }
+
+  // the number of set bits
+  DYNARRAY_NODISCARD size_type count() const noexcept {
+    size_type count = 0;
+    for (const word_type word : words_) {
+      count += static_cast<size_type>(detail::popcount(word));
+    }
+    return count;
+  }
+  DYNARRAY_NODISCARD bool all() const noexcept { return this->count() == size_; }
+  DYNARRAY_NODISCARD bool any() const noexcept { return this->find_first() != size_; }
+  DYNARRAY_NODISCARD bool none() const noexcept { return !this->any(); }
+
+  // the position of the first set bit at or after pos or size() if there is none
+  DYNARRAY_NODISCARD size_type find_first() const noexcept { return this->find_next(0); }
+  DYNARRAY_NODISCARD size_type find_next(const size_type pos) const noexcept {
+    return this->find_next_word(pos, [](const word_type word) noexcept { return word; });
+  }
+  // the position of the first unset bit at or after pos or size() if there is none
+  DYNARRAY_NODISCARD size_type find_first_unset() const noexcept { return this->find_next_unset(0); }
+  DYNARRAY_NODISCARD size_type find_next_unset(const size_type pos) const noexcept {
+    return this->find_next_word(pos, [](const word_type word) noexcept { return ~word; });
+  }
+
+  DYNARRAY_NODISCARD set_bits_range set_bits() const noexcept { return set_bits_range{ words_.data(), words_.size() }; }
+
+  // the bitwise operators require arrays of the same size
+  bit_dynarray& operator&=(const bit_dynarray& rhs) noexcept {
+    assert((this->size() == rhs.size()) && "Undefined behavior if the sizes differ!");
+    for (size_type i = 0; i < words_.size(); ++i) {
+      words_[i] &= rhs.words_[i];
+    }
+    return *this;
+  }
+  bit_dynarray& operator|=(const bit_dynarray& rhs) noexcept {
+    assert((this->size() == rhs.size()) && "Undefined behavior if the sizes differ!");
+    for (size_type i = 0; i < words_.size(); ++i) {
+      words_[i] |= rhs.words_[i];
+    }
+    return *this;
+  }
+  bit_dynarray& operator^=(const bit_dynarray& rhs) noexcept {
+    assert((this->size() == rhs.size()) && "Undefined behavior if the sizes differ!");
+    for (size_type i = 0; i < words_.size(); ++i) {
+      words_[i] ^= rhs.words_[i];
+    }
+    return *this;
+  }
+  DYNARRAY_NODISCARD friend bit_dynarray operator&(bit_dynarray lhs, const bit_dynarray& rhs) noexcept { return lhs &= rhs; }
+  DYNARRAY_NODISCARD friend bit_dynarray operator|(bit_dynarray lhs, const bit_dynarray& rhs) noexcept { return lhs |= rhs; }
+  DYNARRAY_NODISCARD friend bit_dynarray operator^(bit_dynarray lhs, const bit_dynarray& rhs) noexcept { return lhs ^= rhs; }
+  DYNARRAY_NODISCARD friend bit_dynarray operator~(bit_dynarray arr) noexcept {
+    arr.flip();
+    return arr;
+  }
+
+  DYNARRAY_NODISCARD friend bool operator==(const bit_dynarray& lhs, const bit_dynarray& rhs) noexcept {
+    return lhs.size_ == rhs.size_ && lhs.words_ == rhs.words_;
+  }
+  DYNARRAY_NODISCARD friend bool operator!=(const bit_dynarray& lhs, const bit_dynarray& rhs) noexcept { return !(lhs == rhs); }
+
+ private:
+  static size_type num_words_for(const size_type size) noexcept { return (size + bits_per_word() - 1) / bits_per_word(); }
+  static word_type bit_mask(const size_type pos) noexcept { return word_type{ 1 } << (pos % bits_per_word()); }
+
+  // keep the invariant that all bits past size() are zero
+  void clear_unused_bits() noexcept {
+    if (size_ % bits_per_word() != 0) {
+      words_[words_.size() - 1] &= (word_type{ 1 } << (size_ % bits_per_word())) - 1;
+    }
+  }
+
+  // the first set bit of transform(word) at or after pos, where transform selects the bits to search for
+  template <typename Transform>
+  size_type find_next_word(const size_type pos, Transform transform) const noexcept {
+    if (pos >= size_) {
+      return size_;
+    }
+    size_type word_idx = pos / bits_per_word();
+    // ignore the bits in front of pos
+    word_type word = transform(words_[word_idx]) & (~word_type{ 0 } << (pos % bits_per_word()));
+    while (word == 0) {
+      if (++word_idx == words_.size()) {
+        return size_;
+      }
+      word = transform(words_[word_idx]);
+    }
+    const size_type found = word_idx * bits_per_word() + static_cast<size_type>(detail::countr_zero(word));
+    // the inverted unused bits of the last word are set
+    return found < size_ ? found : size_;
+  }
+
+  dynarray<word_type, allocator_type> words_;
+  size_type size_{ 0 };
+};
+
+template <typename Allocator>
+void swap(bit_dynarray<Allocator>& lhs, bit_dynarray<Allocator>& rhs) noexcept {
+  lhs.swap(rhs);
+}
+
+}  // namespace cpp_util
+
+#endif  // CPP_UTIL_BIT_DYNARRAY_HPP
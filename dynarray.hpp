@@ -8,21 +8,53 @@
 #ifndef CPP_UTIL_DYNARRAY_HPP
 #define CPP_UTIL_DYNARRAY_HPP
 
-#include <algorithm>         // std::fill, std::copy, std::swap, std::generate, std::equal, std::lexicographical_compare_three_way, std::lexicographical_compare
+#include <algorithm>         // std::fill, std::copy, std::swap, std::generate, std::equal, std::lexicographical_compare_three_way, std::lexicographical_compare,
+                             // std::min, std::max
 #include <cassert>           // assert
-#include <cstddef>           // std::size_t, std::ptrdiff_t
+#include <cstddef>           // std::size_t, std::ptrdiff_t, std::max_align_t, std::byte
+#include <cstdint>           // std::uint64_t, std::uintptr_t, std::uintmax_t
+#include <cstdlib>           // std::malloc, std::calloc, std::free
+#include <cstring>           // std::memcpy, std::memmove, std::memcmp
+#include <exception>         // std::exception_ptr, std::current_exception, std::rethrow_exception
+#include <functional>        // std::less
 #include <initializer_list>  // std::initializer_list
-#include <iterator>          // std::reverse_iterator, std::distance, std::make_reverse_iterator, std::iterator_traits, std::forward_iterator_tag
+#include <iterator>          // std::reverse_iterator, std::distance, std::make_reverse_iterator, std::iterator_traits, std::forward_iterator_tag,
+                             // std::make_move_iterator, std::contiguous_iterator, std::iter_value_t
 #include <limits>            // std::numeric_limits
-#include <memory>            // std::addressof
+#include <memory>            // std::addressof, std::allocator, std::allocator_traits, std::to_address, std::uses_allocator, std::default_delete
+#include <new>               // std::bad_alloc, std::align_val_t, placement new
 #include <numeric>           // std::iota
-#include <stdexcept>         // std::out_of_range
-#include <type_traits>       // std::remove_cv, std::enable_if, std::is_convertible
-#include <utility>           // std::exchange
+#include <stdexcept>         // std::out_of_range, std::length_error
+#include <thread>            // std::thread
+#include <type_traits>       // std::remove_cv, std::enable_if, std::is_convertible, std::is_same, std::is_empty, std::integral_constant,
+                             // std::is_scalar, std::is_member_pointer, std::is_trivially_default_constructible, std::is_trivially_copyable,
+                             // std::is_pointer, std::remove_pointer, std::is_integral, std::is_unsigned
+#include <utility>           // std::exchange, std::move, std::swap, std::declval
+#include <vector>            // std::vector
 
 #if __has_include(<compare>)
 #include <compare>  // std::strong_ordering
 #endif
+#if __has_include(<memory_resource>)
+#include <memory_resource>  // std::pmr::polymorphic_allocator
+#endif
+#if __has_include(<bit>)
+#include <bit>  // std::countr_zero
+#endif
+#if __has_include(<mdspan>)
+#include <mdspan>  // std::mdspan, std::dextents, std::layout_right
+#endif
+#if __has_include(<ranges>)
+#include <ranges>  // std::ranges::enable_borrowed_range
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>  // _mm_loadu_si128, _mm_cmpeq_epi8, _mm_and_si128, _mm_movemask_epi8
+#define DYNARRAY_HAS_SSE2
+#endif
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>  // _BitScanForward64
+#endif
 
 #if defined(__has_cpp_attribute) && __has_cpp_attribute(nodiscard)
 #define DYNARRAY_NODISCARD [[nodiscard]]
@@ -37,6 +69,12 @@
 #define DYNARRAY_CONSTEXPR
 #endif
 
+#if defined(__cpp_inline_variables)
+#define DYNARRAY_INLINE_VARIABLE inline
+#else
+#define DYNARRAY_INLINE_VARIABLE
+#endif
+
 namespace cpp_util {
 
 namespace detail {
@@ -63,16 +101,639 @@ T exchange(T& obj, U&& new_value) {
 }
 #endif
 
+#if defined(__cpp_lib_allocator_traits_is_always_equal)
+template <typename Allocator>
+using allocator_is_always_equal = typename std::allocator_traits<Allocator>::is_always_equal;
+#else
+// see: https://en.cppreference.com/w/cpp/memory/allocator_traits (is_always_equal defaults to std::is_empty)
+template <typename Allocator>
+using allocator_is_always_equal = std::is_empty<Allocator>;
+#endif
+
+#if defined(__cpp_lib_is_constant_evaluated)
+using std::is_constant_evaluated;
+#else
+constexpr bool is_constant_evaluated() noexcept { return false; }
+#endif
+
+/**
+ * @brief Detects whether an allocator provides the (non-standard) member function `allocate_zeroed(n)`
+ *        returning memory that is already filled with zero bytes (e.g., by using `calloc` or fresh `mmap` pages).
+ */
+template <typename Allocator, typename = void>
+struct has_allocate_zeroed : std::false_type {};
+template <typename Allocator>
+struct has_allocate_zeroed<Allocator, decltype(void(std::declval<Allocator&>().allocate_zeroed(std::size_t{ 0 })))> : std::true_type {};
+
+/**
+ * @brief Detects whether an allocator customizes `construct(ptr, value)`. If not, copy constructing trivially copyable elements
+ *        is equivalent to copying their bytes. `std::allocator` is checked explicitly since it provides `construct` prior to C++20.
+ */
+template <typename Allocator, typename T, typename = void>
+struct has_construct : std::false_type {};
+template <typename Allocator, typename T>
+struct has_construct<Allocator, T, decltype(void(std::declval<Allocator&>().construct(std::declval<T*>(), std::declval<const T&>())))>
+    : std::true_type {};
+// std::pmr::polymorphic_allocator::construct only differs from placement new for types using allocators
+template <typename Allocator, typename T>
+struct is_plain_polymorphic_allocator : std::false_type {};
+#if defined(__cpp_lib_memory_resource)
+template <typename U, typename T>
+struct is_plain_polymorphic_allocator<std::pmr::polymorphic_allocator<U>, T>
+    : std::integral_constant<bool, !std::uses_allocator<T, std::pmr::polymorphic_allocator<U>>::value> {};
+#endif
+template <typename Allocator, typename T>
+using uses_default_construct = std::integral_constant<bool, std::is_same<Allocator, std::allocator<T>>::value ||
+                                                                !has_construct<Allocator, T>::value ||
+                                                                is_plain_polymorphic_allocator<Allocator, T>::value>;
+
+/**
+ * @brief Detects iterators pointing to contiguous memory of elements of type T, i.e., pointers and (since C++20) all iterators
+ *        modeling `std::contiguous_iterator` (e.g., the iterators of `std::vector` or `std::span`).
+ */
+#if defined(__cpp_lib_concepts)
+template <typename It, typename T>
+using is_contiguous_iterator_to =
+    std::integral_constant<bool, std::contiguous_iterator<It> && std::is_same<std::iter_value_t<It>, T>::value>;
+
+using std::to_address;
+#else
+template <typename It, typename T>
+using is_contiguous_iterator_to = std::integral_constant<
+    bool, std::is_pointer<It>::value && std::is_same<typename std::remove_cv<typename std::remove_pointer<It>::type>::type, T>::value>;
+
+template <typename T>
+constexpr T* to_address(T* ptr) noexcept {
+  return ptr;
+}
+#endif
+
+/**
+ * @brief Detects contiguous ranges of elements of type T providing the member functions `data()` and `size()`
+ *        (e.g., `std::vector`, `std::array`, `std::basic_string`, or `std::span`).
+ */
+template <typename Range, typename T, typename = void>
+struct is_contiguous_range_of : std::false_type {};
+template <typename Range, typename T>
+struct is_contiguous_range_of<Range, T, decltype(void(std::declval<const Range&>().data()), void(std::declval<const Range&>().size()))>
+    : is_contiguous_iterator_to<decltype(std::declval<const Range&>().data()), T> {};
+
+/**
+ * @brief Types for which memory filled with zero bytes is equivalent to value-initialization.
+ */
+template <typename T>
+using is_zero_representable = std::integral_constant<bool, std::is_scalar<T>::value && !std::is_member_pointer<T>::value>;
+
+/**
+ * @brief Returns the number of consecutive zero bits starting at the least significant bit of @p x.
+ * @details Uses `tzcnt`/`bsf` via the compiler intrinsics; @p x must not be zero.
+ */
+inline int countr_zero(const std::uint64_t x) noexcept {
+  assert((x != 0) && "Calling countr_zero() is undefined for zero!");
+#if defined(__cpp_lib_bitops)
+  return std::countr_zero(x);
+#elif defined(__GNUC__) || defined(__clang__)
+  return __builtin_ctzll(x);
+#elif defined(_MSC_VER) && defined(_M_X64)
+  unsigned long index;
+  _BitScanForward64(&index, x);
+  return static_cast<int>(index);
+#else
+  int count = 0;
+  for (std::uint64_t val = x; (val & 1u) == 0; val >>= 1) {
+    ++count;
+  }
+  return count;
+#endif
+}
+
+/**
+ * @brief Returns the position of the first byte differing in [lhs, lhs + count) and [rhs, rhs + count) or @p count if all bytes are equal.
+ * @details Compares 64 bytes per iteration using SSE2 (if available) and locates the mismatch using a bit scan over the comparison mask.
+ */
+inline std::size_t mismatch_bytes(const unsigned char* lhs, const unsigned char* rhs, const std::size_t count) noexcept {
+  std::size_t pos = 0;
+#if defined(DYNARRAY_HAS_SSE2)
+  const auto load = [](const unsigned char* ptr) { return _mm_loadu_si128(static_cast<const __m128i*>(static_cast<const void*>(ptr))); };
+  const auto equal_mask = [&](const std::size_t offset) {
+    return static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(load(lhs + offset), load(rhs + offset))));
+  };
+  for (; pos + 64 <= count; pos += 64) {
+    const __m128i eq = _mm_and_si128(_mm_and_si128(_mm_cmpeq_epi8(load(lhs + pos), load(rhs + pos)),
+                                                   _mm_cmpeq_epi8(load(lhs + pos + 16), load(rhs + pos + 16))),
+                                     _mm_and_si128(_mm_cmpeq_epi8(load(lhs + pos + 32), load(rhs + pos + 32)),
+                                                   _mm_cmpeq_epi8(load(lhs + pos + 48), load(rhs + pos + 48))));
+    if (_mm_movemask_epi8(eq) != 0xFFFF) {
+      break;
+    }
+  }
+  for (; pos + 16 <= count; pos += 16) {
+    const unsigned mismatch_mask = equal_mask(pos) ^ 0xFFFFu;
+    if (mismatch_mask != 0) {
+      return pos + static_cast<std::size_t>(countr_zero(mismatch_mask));
+    }
+  }
+#else
+  for (; pos + sizeof(std::uint64_t) <= count; pos += sizeof(std::uint64_t)) {
+    std::uint64_t lhs_word{}, rhs_word{};
+    std::memcpy(&lhs_word, lhs + pos, sizeof(std::uint64_t));
+    std::memcpy(&rhs_word, rhs + pos, sizeof(std::uint64_t));
+    if (lhs_word != rhs_word) {
+      break;
+    }
+  }
+#endif
+  for (; pos < count; ++pos) {
+    if (lhs[pos] != rhs[pos]) {
+      return pos;
+    }
+  }
+  return count;
+}
+
+#if defined(__cpp_lib_byte)
+template <typename T>
+using is_byte = std::is_same<T, std::byte>;
+#else
+template <typename T>
+using is_byte = std::false_type;
+#endif
+
+/**
+ * @brief Types for which equality of two values is equivalent to the equality of their bytes.
+ */
+template <typename T>
+using is_bitwise_comparable = std::integral_constant<bool, std::is_integral<T>::value || is_byte<T>::value>;
+/**
+ * @brief Types for which additionally the ordering of two values is equivalent to the ordering of their bytes as reported by std::memcmp.
+ */
+template <typename T>
+using is_bytewise_orderable =
+    std::integral_constant<bool, (std::is_integral<T>::value && std::is_unsigned<T>::value && sizeof(T) == 1) || is_byte<T>::value>;
+
+/**
+ * @brief Lexicographically compares [lhs, lhs + lhs_count) and [rhs, rhs + rhs_count) returning a negative value, zero,
+ *        or a positive value. Only valid for bitwise comparable types.
+ */
+template <typename T>
+int lexicographical_compare_bitwise(const T* lhs, const std::size_t lhs_count, const T* rhs, const std::size_t rhs_count) noexcept {
+  const std::size_t count = (std::min)(lhs_count, rhs_count);
+  if (count != 0) {
+    if (is_bytewise_orderable<T>::value) {
+      const int res = std::memcmp(lhs, rhs, count);
+      if (res != 0) {
+        return res;
+      }
+    } else {
+      // the first mismatching byte belongs to the first mismatching element
+      const std::size_t pos = mismatch_bytes(static_cast<const unsigned char*>(static_cast<const void*>(lhs)),
+                                             static_cast<const unsigned char*>(static_cast<const void*>(rhs)), count * sizeof(T)) /
+                              sizeof(T);
+      if (pos != count) {
+        return lhs[pos] < rhs[pos] ? -1 : 1;
+      }
+    }
+  }
+  return lhs_count < rhs_count ? -1 : (lhs_count == rhs_count ? 0 : 1);
+}
+
+template <typename T>
+DYNARRAY_CONSTEXPR bool equal_elements(const T* lhs, const T* rhs, const std::size_t count, std::false_type) {
+  return std::equal(lhs, lhs + count, rhs);
+}
+template <typename T>
+DYNARRAY_CONSTEXPR bool equal_elements(const T* lhs, const T* rhs, const std::size_t count, std::true_type) {
+  if (is_constant_evaluated()) {
+    return equal_elements(lhs, rhs, count, std::false_type{});
+  }
+  return count == 0 || std::memcmp(lhs, rhs, count * sizeof(T)) == 0;
+}
+
+template <typename T>
+DYNARRAY_CONSTEXPR bool lexicographical_less(const T* lhs, const std::size_t lhs_count, const T* rhs, const std::size_t rhs_count,
+                                             std::false_type) {
+  return std::lexicographical_compare(lhs, lhs + lhs_count, rhs, rhs + rhs_count);
+}
+template <typename T>
+DYNARRAY_CONSTEXPR bool lexicographical_less(const T* lhs, const std::size_t lhs_count, const T* rhs, const std::size_t rhs_count,
+                                             std::true_type) {
+  if (is_constant_evaluated()) {
+    return lexicographical_less(lhs, lhs_count, rhs, rhs_count, std::false_type{});
+  }
+  return lexicographical_compare_bitwise(lhs, lhs_count, rhs, rhs_count) < 0;
+}
+
+#if defined(__cpp_impl_three_way_comparison) && defined(__cpp_lib_three_way_comparison)
+template <typename T>
+constexpr auto lexicographical_compare_three_way(const T* lhs, const std::size_t lhs_count, const T* rhs, const std::size_t rhs_count,
+                                                 std::false_type) {
+  return std::lexicographical_compare_three_way(lhs, lhs + lhs_count, rhs, rhs + rhs_count);
+}
+template <typename T>
+constexpr auto lexicographical_compare_three_way(const T* lhs, const std::size_t lhs_count, const T* rhs, const std::size_t rhs_count,
+                                                 std::true_type) {
+  if (is_constant_evaluated()) {
+    return lexicographical_compare_three_way(lhs, lhs_count, rhs, rhs_count, std::false_type{});
+  }
+  return lexicographical_compare_bitwise(lhs, lhs_count, rhs, rhs_count) <=> 0;
+}
+#endif
+
+/**
+ * @brief Assumed size of a cache line in bytes (`std::hardware_destructive_interference_size` isn't ABI stable).
+ */
+constexpr std::size_t cache_line_size = 64;
+
+/**
+ * @brief Splits the @p size elements starting at @p data into (at most) @p num_threads chunks and calls `func(first, last)`
+ *        for each chunk of indices in a separate thread (the first chunk is handled by the calling thread).
+ * @details The chunk boundaries are moved to the next cache line boundary (as far as the element size allows) to prevent false sharing.
+ *          Threads are only spawned for chunks of at least `min_chunk_bytes` bytes. If a thread can't be started, the calling thread
+ *          processes the chunks that are left over. The first exception thrown by `func` is rethrown.
+ */
+template <typename T, typename Func>
+void parallel_for_chunks(const T* data, const std::size_t size, std::size_t num_threads, Func func) {
+  constexpr std::size_t min_chunk_bytes = 1 << 16;
+  num_threads = (std::max)(std::size_t{ 1 }, (std::min)(num_threads, size * sizeof(T) / min_chunk_bytes));
+  if (num_threads == 1) {
+    func(std::size_t{ 0 }, size);
+    return;
+  }
+
+  // calculate the chunk boundaries such that the first element of each chunk starts at a cache line
+  const std::uintptr_t base = reinterpret_cast<std::uintptr_t>(data);
+  std::vector<std::size_t> bounds(num_threads + 1, size);
+  bounds.front() = 0;
+  for (std::size_t i = 1; i < num_threads; ++i) {
+    const std::uintptr_t addr = base + (i * (size / num_threads)) * sizeof(T);
+    const std::uintptr_t aligned_addr = (addr + cache_line_size - 1) & ~static_cast<std::uintptr_t>(cache_line_size - 1);
+    bounds[i] = (std::min)(size, (static_cast<std::size_t>(aligned_addr - base) + sizeof(T) - 1) / sizeof(T));
+  }
+
+  std::vector<std::exception_ptr> exceptions(num_threads);
+  const auto run_chunk = [&](const std::size_t chunk) {
+    try {
+      if (bounds[chunk] < bounds[chunk + 1]) {
+        func(bounds[chunk], bounds[chunk + 1]);
+      }
+    } catch (...) {
+      exceptions[chunk] = std::current_exception();
+    }
+  };
+  std::vector<std::thread> threads;
+  threads.reserve(num_threads - 1);
+  std::size_t chunk = 1;
+  try {
+    for (; chunk < num_threads; ++chunk) {
+      threads.emplace_back(run_chunk, chunk);
+    }
+  } catch (...) {
+    // no further thread could be started (e.g., EAGAIN) -> the calling thread handles the remaining chunks, the started threads are
+    // joined below as usual
+  }
+  for (; chunk < num_threads; ++chunk) {
+    run_chunk(chunk);
+  }
+  run_chunk(0);
+  for (std::thread& t : threads) {
+    t.join();
+  }
+  for (const std::exception_ptr& ex : exceptions) {
+    if (ex) {
+      std::rethrow_exception(ex);
+    }
+  }
+}
+
+/**
+ * @brief Stores the allocator of a cpp_util::dynarray using the empty base optimization if possible,
+ *        i.e., stateless allocators don't increase the size of a cpp_util::dynarray.
+ */
+template <typename Allocator, bool = std::is_empty<Allocator>::value>
+class allocator_storage : private Allocator {
+ protected:
+  DYNARRAY_CONSTEXPR explicit allocator_storage(const Allocator& alloc) noexcept : Allocator(alloc) {}
+  DYNARRAY_CONSTEXPR explicit allocator_storage(Allocator&& alloc) noexcept : Allocator(std::move(alloc)) {}
+
+  DYNARRAY_NODISCARD DYNARRAY_CONSTEXPR Allocator& allocator() noexcept { return *this; }
+  DYNARRAY_NODISCARD DYNARRAY_CONSTEXPR const Allocator& allocator() const noexcept { return *this; }
+};
+template <typename Allocator>
+class allocator_storage<Allocator, false> {
+ protected:
+  DYNARRAY_CONSTEXPR explicit allocator_storage(const Allocator& alloc) noexcept : alloc_(alloc) {}
+  DYNARRAY_CONSTEXPR explicit allocator_storage(Allocator&& alloc) noexcept : alloc_(std::move(alloc)) {}
+
+  DYNARRAY_NODISCARD DYNARRAY_CONSTEXPR Allocator& allocator() noexcept { return alloc_; }
+  DYNARRAY_NODISCARD DYNARRAY_CONSTEXPR const Allocator& allocator() const noexcept { return alloc_; }
+
+ private:
+  Allocator alloc_;
+};
+
 }  // namespace detail
 
+/**
+ * @brief Tag type to request default-initialization of the elements (analog to `std::make_unique_for_overwrite`),
+ *        i.e., trivially default constructible elements are left uninitialized and the memory isn't touched. Other elements are
+ *        constructed through the allocator if it customizes `construct`.
+ */
+struct for_overwrite_t {
+  explicit for_overwrite_t() = default;
+};
+DYNARRAY_INLINE_VARIABLE constexpr for_overwrite_t for_overwrite{};
+
+/**
+ * @brief Tag type to request value-initialization of the elements, i.e., scalar elements are zeroed.
+ *        If the allocator provides `allocate_zeroed(n)` (e.g., cpp_util::malloc_allocator), its zeroed memory is used directly.
+ */
+struct value_init_t {
+  explicit value_init_t() = default;
+};
+DYNARRAY_INLINE_VARIABLE constexpr value_init_t value_init{};
+
+/**
+ * @brief Allocator using `std::malloc`/`std::free`. Implements `allocate_zeroed(n)` using `std::calloc`, which
+ *        (for large allocations) obtains fresh zero pages from the operating system without writing to them.
+ */
+template <typename T>
+class malloc_allocator {
+ public:
+  using value_type = T;
+
+  static_assert(alignof(T) <= alignof(std::max_align_t), "cpp_util::malloc_allocator doesn't support over-aligned types");
+
+  constexpr malloc_allocator() noexcept = default;
+  template <typename U>
+  constexpr malloc_allocator(const malloc_allocator<U>&) noexcept {}
+
+  DYNARRAY_NODISCARD T* allocate(const std::size_t n) { return check_allocation(std::malloc(n * sizeof(T)), n); }
+  DYNARRAY_NODISCARD T* allocate_zeroed(const std::size_t n) { return check_allocation(std::calloc(n, sizeof(T)), n); }
+  void deallocate(T* ptr, std::size_t) noexcept { std::free(ptr); }
+
+  friend constexpr bool operator==(const malloc_allocator&, const malloc_allocator&) noexcept { return true; }
+  friend constexpr bool operator!=(const malloc_allocator&, const malloc_allocator&) noexcept { return false; }
+
+ private:
+  static T* check_allocation(void* ptr, const std::size_t n) {
+    if (ptr == nullptr && n != 0) {
+      throw std::bad_alloc{};
+    }
+    return static_cast<T*>(ptr);
+  }
+};
+
+/**
+ * @brief Execution policy for the parallel overloads of cpp_util::dynarray::fill, cpp_util::dynarray::iota, and
+ *        cpp_util::dynarray::generate using `std::thread`s. `cpp_util::par` uses all hardware threads, `cpp_util::par(n)` uses n threads.
+ */
+class parallel_policy {
+ public:
+  constexpr parallel_policy() noexcept = default;
+  constexpr explicit parallel_policy(const std::size_t num_threads) noexcept : num_threads_{ num_threads } {}
+
+  DYNARRAY_NODISCARD constexpr parallel_policy operator()(const std::size_t num_threads) const noexcept {
+    return parallel_policy{ num_threads };
+  }
+  DYNARRAY_NODISCARD std::size_t num_threads() const noexcept {
+    // std::thread::hardware_concurrency() may return 0 if the value isn't computable
+    return num_threads_ != 0 ? num_threads_ : (std::max)(1u, std::thread::hardware_concurrency());
+  }
+
+ private:
+  std::size_t num_threads_{ 0 };
+};
+DYNARRAY_INLINE_VARIABLE constexpr parallel_policy par{};
+
+/**
+ * @brief Allocator returning memory aligned to @p Alignment bytes (defaults to a cache line). If @p PadToAlignment is `true`, the size of
+ *        each allocation is rounded up to a multiple of @p Alignment, i.e., SIMD loads may safely read past the last element and
+ *        the memory of two allocations never shares a cache line.
+ */
+template <typename T, std::size_t Alignment = detail::cache_line_size, bool PadToAlignment = false>
+class aligned_allocator {
+ public:
+  using value_type = T;
+
+  static_assert(Alignment != 0 && (Alignment & (Alignment - 1)) == 0, "cpp_util::aligned_allocator requires a power of two alignment");
+  static_assert(Alignment >= alignof(T), "cpp_util::aligned_allocator can't decrease the alignment of T");
+
+  template <typename U>
+  struct rebind {
+    using other = aligned_allocator<U, Alignment, PadToAlignment>;
+  };
+
+  constexpr aligned_allocator() noexcept = default;
+  template <typename U>
+  constexpr aligned_allocator(const aligned_allocator<U, Alignment, PadToAlignment>&) noexcept {}
+
+  DYNARRAY_NODISCARD T* allocate(const std::size_t n) {
+    if (n > max_size()) {
+      throw std::bad_alloc{};
+    }
+#if defined(__cpp_aligned_new)
+    return static_cast<T*>(::operator new(allocation_size(n), std::align_val_t{ Alignment }));
+#else
+    // over-allocate and store the original pointer directly in front of the aligned memory
+    void* ptr = std::malloc(allocation_size(n) + Alignment + sizeof(void*));
+    if (ptr == nullptr) {
+      throw std::bad_alloc{};
+    }
+    const std::uintptr_t aligned = (reinterpret_cast<std::uintptr_t>(ptr) + sizeof(void*) + Alignment - 1) & ~(Alignment - 1);
+    std::memcpy(reinterpret_cast<void*>(aligned - sizeof(void*)), &ptr, sizeof(void*));
+    return reinterpret_cast<T*>(aligned);
+#endif
+  }
+  void deallocate(T* ptr, std::size_t) noexcept {
+#if defined(__cpp_aligned_new)
+    ::operator delete(ptr, std::align_val_t{ Alignment });
+#else
+    void* original = nullptr;
+    std::memcpy(&original, reinterpret_cast<const unsigned char*>(ptr) - sizeof(void*), sizeof(void*));
+    std::free(original);
+#endif
+  }
+
+  DYNARRAY_NODISCARD static constexpr std::size_t max_size() noexcept {
+    return (std::numeric_limits<std::ptrdiff_t>::max() - 2 * Alignment) / sizeof(T);
+  }
+
+  friend constexpr bool operator==(const aligned_allocator&, const aligned_allocator&) noexcept { return true; }
+  friend constexpr bool operator!=(const aligned_allocator&, const aligned_allocator&) noexcept { return false; }
+
+ private:
+  static constexpr std::size_t allocation_size(const std::size_t n) noexcept {
+    return PadToAlignment ? (n * sizeof(T) + Alignment - 1) & ~(Alignment - 1) : n * sizeof(T);
+  }
+};
+
+/**
+ * @brief Allocator for a cpp_util::dynarray adopting a buffer owned by a @p Deleter (e.g., the `std::default_delete<T[]>` of a
+ *        `std::unique_ptr<T[]>` or the free function of a decoder). The adopted buffer and its elements are released by calling
+ *        `deleter(ptr)`, all other memory (e.g., of copies) is obtained from `std::allocator<T>`. The adopted buffer is owned by exactly
+ *        one allocator: it is transferred by moving the allocator (which cpp_util::dynarray does together with its buffer), whereas copies
+ *        only share the deleter. Hence, an allocator owning an adopted buffer compares unequal to all other allocators.
+ */
+template <typename T, typename Deleter = std::default_delete<T[]>>
+class deleter_allocator {
+ public:
+  using value_type = T;
+  using deleter_type = Deleter;
+  using propagate_on_container_copy_assignment = std::true_type;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+
+  deleter_allocator() = default;
+  explicit deleter_allocator(Deleter deleter) noexcept : deleter_(std::move(deleter)) {}
+  // adopt the buffer [ptr, ptr + size)
+  deleter_allocator(T* ptr, const std::size_t size, Deleter deleter = Deleter()) noexcept
+      : deleter_(std::move(deleter)), first_{ ptr }, last_{ ptr + size } {}
+  template <typename U>
+  deleter_allocator(const deleter_allocator<U, Deleter>& other) noexcept : deleter_(other.get_deleter()) {}
+  deleter_allocator(const deleter_allocator& other) noexcept : deleter_(other.deleter_) {}
+  deleter_allocator(deleter_allocator&& other) noexcept
+      : deleter_(std::move(other.deleter_)),
+        first_{ detail::exchange(other.first_, nullptr) },
+        last_{ detail::exchange(other.last_, nullptr) } {}
+  // a copy-assigned allocator keeps its adopted buffer
+  deleter_allocator& operator=(const deleter_allocator& other) noexcept {
+    deleter_ = other.deleter_;
+    return *this;
+  }
+  deleter_allocator& operator=(deleter_allocator&& other) noexcept {
+    deleter_ = std::move(other.deleter_);
+    first_ = detail::exchange(other.first_, nullptr);
+    last_ = detail::exchange(other.last_, nullptr);
+    return *this;
+  }
+
+  DYNARRAY_NODISCARD T* allocate(const std::size_t n) { return std::allocator<T>{}.allocate(n); }
+  void deallocate(T* ptr, const std::size_t n) noexcept {
+    if (first_ != nullptr && ptr == first_) {
+      deleter_(ptr);
+      first_ = last_ = nullptr;
+    } else {
+      std::allocator<T>{}.deallocate(ptr, n);
+    }
+  }
+  // the elements of the adopted buffer are destroyed by the deleter
+  template <typename U>
+  void destroy(U* ptr) noexcept {
+    if (!this->is_adopted(ptr)) {
+      ptr->~U();
+    }
+  }
+
+  DYNARRAY_NODISCARD Deleter& get_deleter() noexcept { return deleter_; }
+  DYNARRAY_NODISCARD const Deleter& get_deleter() const noexcept { return deleter_; }
+
+  friend bool operator==(const deleter_allocator& lhs, const deleter_allocator& rhs) noexcept { return lhs.first_ == rhs.first_; }
+  friend bool operator!=(const deleter_allocator& lhs, const deleter_allocator& rhs) noexcept { return !(lhs == rhs); }
+
+ private:
+  bool is_adopted(const void* ptr) const noexcept {
+    // std::less provides a total order even for pointers into different arrays
+    return !std::less<const void*>{}(ptr, first_) && std::less<const void*>{}(ptr, last_);
+  }
+
+  Deleter deleter_{};
+  T* first_{ nullptr };
+  T* last_{ nullptr };
+};
+
+/**
+ * @brief A non-owning view of contiguous elements (e.g., a row of a cpp_util::jagged_dynarray or a field of a cpp_util::soa_dynarray)
+ *        with the element access, iterator, and fill(), iota(), and generate() member functions of a cpp_util::dynarray.
+ *        The elements are modifiable unless @p T is const.
+ */
 template <typename T>
-class dynarray {
+class row_view {
+ public:
+  using element_type = T;
+  using value_type = typename std::remove_cv<T>::type;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = element_type&;
+  using pointer = element_type*;
+  using iterator = pointer;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+
+  constexpr row_view() noexcept = default;
+  constexpr row_view(pointer data, const size_type size) noexcept : data_{ data }, size_{ size } {}
+  // a view of modifiable elements is implicitly convertible to a view of const elements
+  template <typename U, typename std::enable_if<std::is_convertible<U (*)[], T (*)[]>::value, bool>::type = true>
+  constexpr row_view(const row_view<U>& other) noexcept : data_{ other.data() }, size_{ other.size() } {}
+
+  DYNARRAY_NODISCARD reference at(const size_type pos) const {
+    if (pos >= size_) throw std::out_of_range{ "Index out-of-range: pos >= this->size()" };
+    return data_[pos];
+  }
+  DYNARRAY_NODISCARD reference operator[](const size_type pos) const {
+    assert((pos < this->size()) && "Undefined behavior if pos >= this->size()!");
+    return data_[pos];
+  }
+  DYNARRAY_NODISCARD reference front() const {
+    assert((!this->empty()) && "Calling front() is undefined for empty row_views!");
+    return data_[0];
+  }
+  DYNARRAY_NODISCARD reference back() const {
+    assert((!this->empty()) && "Calling back() is undefined for empty row_views!");
+    return data_[size_ - 1];
+  }
+  DYNARRAY_NODISCARD constexpr pointer data() const noexcept { return data_; }
+
+  DYNARRAY_NODISCARD constexpr iterator begin() const noexcept { return data_; }
+  DYNARRAY_NODISCARD constexpr iterator end() const noexcept { return data_ + size_; }
+  DYNARRAY_NODISCARD reverse_iterator rbegin() const noexcept { return detail::make_reverse_iterator(this->end()); }
+  DYNARRAY_NODISCARD reverse_iterator rend() const noexcept { return detail::make_reverse_iterator(this->begin()); }
+
+  DYNARRAY_NODISCARD constexpr bool empty() const noexcept { return size_ == 0; }
+  DYNARRAY_NODISCARD constexpr size_type size() const noexcept { return size_; }
+
+  void fill(const value_type& value = value_type{}) const { std::fill(this->begin(), this->end(), value); }
+  void iota(const value_type& value = value_type{}) const { std::iota(this->begin(), this->end(), value); }
+  template <typename Generator>
+  void generate(Generator gen) const {
+    std::generate(this->begin(), this->end(), gen);
+  }
+
+  DYNARRAY_NODISCARD friend bool operator==(const row_view& lhs, const row_view& rhs) {
+    return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+  }
+  DYNARRAY_NODISCARD friend bool operator!=(const row_view& lhs, const row_view& rhs) { return !(lhs == rhs); }
+
+ private:
+  pointer data_{ nullptr };
+  size_type size_{ 0 };
+};
+
+/**
+ * @brief A runtime fixed-size array. @p SizeType may be a narrower unsigned integer type (e.g., `std::uint32_t`) limiting the maximum
+ *        number of elements; together with the data pointer placed first, all padding ends up at the end of the object.
+ */
+template <typename T, typename Allocator = std::allocator<T>, typename SizeType = std::size_t>
+class dynarray : private detail::allocator_storage<Allocator> {
+  using allocator_base = detail::allocator_storage<Allocator>;
+  using allocator_traits = std::allocator_traits<Allocator>;
+  // value-initialization is free if the allocator already provides zeroed memory
+  using uses_zeroed_storage =
+      std::integral_constant<bool, detail::has_allocate_zeroed<Allocator>::value && detail::is_zero_representable<T>::value>;
+  // copying the elements from a contiguous range is a single std::memcpy/std::memmove
+  template <typename It>
+  using is_bitwise_assignable_from =
+      std::integral_constant<bool, std::is_trivially_copyable<T>::value && detail::is_contiguous_iterator_to<It, T>::value>;
+  template <typename It>
+  using is_bitwise_constructible_from =
+      std::integral_constant<bool, is_bitwise_assignable_from<It>::value && detail::uses_default_construct<Allocator, T>::value>;
+
+
  public:
   /**************************************************************************************************************************************/
   /**                                                              types                                                               **/
   /**************************************************************************************************************************************/
   using value_type = T;
-  using size_type = std::size_t;
+  using allocator_type = Allocator;
+  using size_type = SizeType;
   using difference_type = std::ptrdiff_t;
   using reference = value_type&;
   using const_reference = const value_type&;
@@ -85,36 +746,93 @@ class dynarray {
 
   static_assert(std::is_same<typename std::remove_cv<value_type>::type, value_type>::value,
                 "cpp_util::dynarray must have a non-const, non-volatile value_type");
+  static_assert(std::is_same<typename allocator_traits::value_type, value_type>::value,
+                "cpp_util::dynarray must have the same value_type as its allocator");
+  static_assert(std::is_same<typename allocator_traits::pointer, pointer>::value,
+                "cpp_util::dynarray doesn't support allocators with fancy pointers");
+  static_assert(std::is_integral<size_type>::value && std::is_unsigned<size_type>::value && !std::is_same<size_type, bool>::value,
+                "cpp_util::dynarray must have an unsigned integral size_type");
 
   /**************************************************************************************************************************************/
   /**                                                           construction                                                           **/
   /**************************************************************************************************************************************/
-  DYNARRAY_CONSTEXPR dynarray() noexcept = default;
-  DYNARRAY_CONSTEXPR explicit dynarray(const size_type size) : size_{ size }, data_{ new value_type[size] } {}
-  DYNARRAY_CONSTEXPR dynarray(const size_type size, const value_type& init) : dynarray(size) {
+  DYNARRAY_CONSTEXPR dynarray() noexcept(noexcept(allocator_type())) : dynarray(allocator_type()) {}
+  DYNARRAY_CONSTEXPR explicit dynarray(const allocator_type& alloc) noexcept : allocator_base(alloc) {}
+  DYNARRAY_CONSTEXPR explicit dynarray(const size_type size, const allocator_type& alloc = allocator_type())
+      : dynarray(size, value_init, alloc) {}
+  DYNARRAY_CONSTEXPR dynarray(const size_type size, value_init_t, const allocator_type& alloc = allocator_type())
+      : allocator_base(alloc), data_{ this->allocate_storage(size, uses_zeroed_storage{}) }, size_{ size } {
+    // value-initialize all elements
+    this->value_initialize_elements(uses_zeroed_storage{});
+  }
+  DYNARRAY_CONSTEXPR dynarray(const size_type size, for_overwrite_t, const allocator_type& alloc = allocator_type())
+      : allocator_base(alloc), data_{ this->allocate_storage(size) }, size_{ size } {
+    // default-initialize all elements
+    this->default_initialize_elements();
+  }
+  DYNARRAY_CONSTEXPR dynarray(const size_type size, const value_type& init, const allocator_type& alloc = allocator_type())
+      : allocator_base(alloc), data_{ this->allocate_storage(size) }, size_{ size } {
     // initialize with same value
-    this->fill(init);
+    this->construct_elements(init);
   }
   template <typename ForwardIt, typename std::enable_if<std::is_convertible<typename std::iterator_traits<ForwardIt>::iterator_category,
                                                                             std::forward_iterator_tag>::value,
                                                         bool>::type = true>
-  DYNARRAY_CONSTEXPR dynarray(ForwardIt first, ForwardIt last) : dynarray(static_cast<size_type>(std::distance(first, last))) {
+  DYNARRAY_CONSTEXPR dynarray(ForwardIt first, ForwardIt last, const allocator_type& alloc = allocator_type()) : allocator_base(alloc) {
+    // the number of elements must be representable by size_type
+    const size_type size = checked_size(std::distance(first, last));
+    data_ = this->allocate_storage(size);
+    size_ = size;
     // copy values from iterator range
-    std::copy(first, last, this->begin());
-  }
-  DYNARRAY_CONSTEXPR dynarray(std::initializer_list<value_type> ilist) : dynarray{ ilist.begin(), ilist.end() } {}
-  DYNARRAY_CONSTEXPR dynarray(const dynarray& other) : dynarray(other.size_) {
-    // copy values from other
-    std::copy(other.cbegin(), other.cend(), this->begin());
+    this->construct_elements_from(first);
   }
+  DYNARRAY_CONSTEXPR dynarray(std::initializer_list<value_type> ilist, const allocator_type& alloc = allocator_type())
+      : dynarray(ilist.begin(), ilist.end(), alloc) {}
+  // copy the elements of a contiguous range (e.g., a std::vector or std::span); trivially copyable types result in a single std::memcpy
+  template <typename ContiguousRange,
+            typename std::enable_if<detail::is_contiguous_range_of<ContiguousRange, T>::value && !std::is_same<ContiguousRange, dynarray>::value,
+                                    bool>::type = true>
+  DYNARRAY_CONSTEXPR explicit dynarray(const ContiguousRange& range, const allocator_type& alloc = allocator_type())
+      : dynarray(range.data(), range.data() + range.size(), alloc) {}
+  DYNARRAY_CONSTEXPR dynarray(const dynarray& other)
+      : dynarray(other, allocator_traits::select_on_container_copy_construction(other.allocator())) {}
+  DYNARRAY_CONSTEXPR dynarray(const dynarray& other, const allocator_type& alloc) : dynarray(other.cbegin(), other.cend(), alloc) {}
   DYNARRAY_CONSTEXPR dynarray(dynarray&& other) noexcept
-      : size_{ detail::exchange(other.size_, size_type{ 0 }) }, data_{ detail::exchange(other.data_, nullptr) } {}
+      : allocator_base(std::move(other.allocator())),
+        data_{ detail::exchange(other.data_, nullptr) },
+        size_{ detail::exchange(other.size_, size_type{ 0 }) } {}
+  DYNARRAY_CONSTEXPR dynarray(dynarray&& other, const allocator_type& alloc) : allocator_base(alloc) {
+    if (this->allocator() == other.allocator()) {
+      // the memory of other can be released using our allocator -> steal it
+      this->swap_storage(other);
+    } else {
+      // different allocators -> move the elements one by one
+      dynarray tmp(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()), alloc);
+      this->swap_storage(tmp);
+    }
+  }
+  // take ownership of size constructed elements without copying them; the memory must be deallocatable by the allocator, e.g.,
+  // a std::malloc'ed buffer using cpp_util::malloc_allocator or the buffer of a std::unique_ptr<T[]> using cpp_util::deleter_allocator
+  DYNARRAY_NODISCARD DYNARRAY_CONSTEXPR static dynarray adopt(const pointer ptr, const size_type size) noexcept {
+    return dynarray(adopting_allocator(ptr, size, std::is_constructible<allocator_type, pointer, size_type>{}), ptr, size);
+  }
+  DYNARRAY_NODISCARD DYNARRAY_CONSTEXPR static dynarray adopt(const pointer ptr, const size_type size, allocator_type alloc) noexcept {
+    return dynarray(std::move(alloc), ptr, size);
+  }
+  // the allocator is constructed from the buffer and its deleter (see cpp_util::deleter_allocator)
+  template <typename Deleter, typename std::enable_if<std::is_constructible<allocator_type, pointer, size_type, Deleter>::value &&
+                                                          !std::is_same<Deleter, allocator_type>::value,
+                                                      bool>::type = true>
+  DYNARRAY_NODISCARD DYNARRAY_CONSTEXPR static dynarray adopt(const pointer ptr, const size_type size, Deleter deleter) noexcept {
+    return dynarray(allocator_type(ptr, size, std::move(deleter)), ptr, size);
+  }
 
   /**************************************************************************************************************************************/
   /**                                                           destruction                                                            **/
   /**************************************************************************************************************************************/
   DYNARRAY_CONSTEXPR ~dynarray() {
-    delete[] data_;
+    this->destroy_elements(data_, data_ + size_);
+    this->deallocate_storage(data_, size_);
     size_ = 0;
   }
 
@@ -124,32 +842,52 @@ class dynarray {
   DYNARRAY_CONSTEXPR dynarray& operator=(const dynarray& other) {
     // guard against self assignment
     if (this != std::addressof(other)) {
-      // if sizes mismatch use copy-and-swap idiom,
-      // otherwise just directly assign new values
-      if (other.size_ != size_) {
-        dynarray tmp{ other };
-        this->swap(tmp);
+      if (allocator_traits::propagate_on_container_copy_assignment::value && this->allocator() != other.allocator()) {
+        // our memory can't be released by the new allocator -> copy using the allocator of other and take both
+        dynarray tmp(other, other.allocator());
+        this->swap_storage(tmp);
+        using std::swap;
+        swap(this->allocator(), tmp.allocator());
       } else {
-        // perform copy
-        std::copy(other.cbegin(), other.cend(), this->begin());
+        // if sizes mismatch use copy-and-swap idiom,
+        // otherwise just directly assign new values
+        if (other.size_ != size_) {
+          dynarray tmp(other, this->allocator());
+          this->swap(tmp);
+        } else {
+          // perform copy
+          this->copy_assign_elements(other.cbegin(), other.cend());
+        }
+        this->propagate_allocator(other, typename allocator_traits::propagate_on_container_copy_assignment{});
       }
     }
     return *this;
   }
-  DYNARRAY_CONSTEXPR dynarray& operator=(dynarray&& other) noexcept {
-    dynarray tmp{ std::move(other) };
-    this->swap(tmp);
+  DYNARRAY_CONSTEXPR dynarray& operator=(dynarray&& other) noexcept(allocator_traits::propagate_on_container_move_assignment::value ||
+                                                                    detail::allocator_is_always_equal<allocator_type>::value) {
+    if (allocator_traits::propagate_on_container_move_assignment::value || this->allocator() == other.allocator()) {
+      // steal the memory of other, our old memory gets released by tmp using our old allocator
+      dynarray tmp{ std::move(other) };
+      this->swap_storage(tmp);
+      if (allocator_traits::propagate_on_container_move_assignment::value) {
+        using std::swap;
+        swap(this->allocator(), tmp.allocator());
+      }
+    } else {
+      // our allocator can't release the memory of other -> move the elements one by one
+      this->assign(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+    }
     return *this;
   }
   DYNARRAY_CONSTEXPR dynarray& operator=(std::initializer_list<value_type> ilist) {
     // if sizes mismatch use copy-and-swap idiom,
     // otherwise just directly assign new values
     if (ilist.size() != size_) {
-      dynarray tmp{ ilist };
+      dynarray tmp(ilist, this->allocator());
       this->swap(tmp);
     } else {
       // perform assignment
-      std::copy(ilist.begin(), ilist.end(), this->begin());
+      this->copy_assign_elements(ilist.begin(), ilist.end());
     }
     return *this;
   }
@@ -158,7 +896,7 @@ class dynarray {
     // if sizes mismatch use copy-and-swap idiom,
     // otherwise just directly assign new values
     if (count != size_) {
-      dynarray tmp(count, value);
+      dynarray tmp(count, value, this->allocator());
       this->swap(tmp);
     } else {
       // perform assignment
@@ -171,16 +909,18 @@ class dynarray {
   DYNARRAY_CONSTEXPR void assign(ForwardIt first, ForwardIt last) {
     // if sizes mismatch use copy-and-swap idiom,
     // otherwise just directly assign new values
-    if (static_cast<size_type>(std::distance(first, last)) != size_) {
-      dynarray tmp(first, last);
+    if (checked_size(std::distance(first, last)) != size_) {
+      dynarray tmp(first, last, this->allocator());
       this->swap(tmp);
     } else {
       // perform assignment
-      std::copy(first, last, this->begin());
+      this->copy_assign_elements(first, last);
     }
   }
   DYNARRAY_CONSTEXPR void assign(std::initializer_list<value_type> ilist) { this->assign(ilist.begin(), ilist.end()); }
 
+  DYNARRAY_NODISCARD DYNARRAY_CONSTEXPR allocator_type get_allocator() const noexcept { return this->allocator(); }
+
   /**************************************************************************************************************************************/
   /**                                                          element access                                                          **/
   /**************************************************************************************************************************************/
@@ -218,6 +958,20 @@ class dynarray {
   }
   DYNARRAY_NODISCARD DYNARRAY_CONSTEXPR pointer data() { return data_; }
   DYNARRAY_NODISCARD DYNARRAY_CONSTEXPR const_pointer data() const { return data_; }
+#if defined(__cpp_lib_mdspan)
+  // a multidimensional view of the elements, e.g., arr.as_mdspan(rows, cols) (the product of the extents must be equal to size())
+  template <typename Layout = std::layout_right, typename... Extents>
+  DYNARRAY_NODISCARD DYNARRAY_CONSTEXPR std::mdspan<value_type, std::dextents<size_type, sizeof...(Extents)>, Layout> as_mdspan(const Extents... exts) {
+    assert(((static_cast<size_type>(exts) * ... * size_type{ 1 }) == size_) && "The product of the extents must be equal to size()!");
+    return std::mdspan<value_type, std::dextents<size_type, sizeof...(Extents)>, Layout>{ data_, static_cast<size_type>(exts)... };
+  }
+  template <typename Layout = std::layout_right, typename... Extents>
+  DYNARRAY_NODISCARD DYNARRAY_CONSTEXPR std::mdspan<const value_type, std::dextents<size_type, sizeof...(Extents)>, Layout> as_mdspan(
+      const Extents... exts) const {
+    assert(((static_cast<size_type>(exts) * ... * size_type{ 1 }) == size_) && "The product of the extents must be equal to size()!");
+    return std::mdspan<const value_type, std::dextents<size_type, sizeof...(Extents)>, Layout>{ data_, static_cast<size_type>(exts)... };
+  }
+#endif
 
   /**************************************************************************************************************************************/
   /**                                                         iterator support                                                         **/
@@ -249,15 +1003,30 @@ class dynarray {
   DYNARRAY_NODISCARD DYNARRAY_CONSTEXPR bool empty() const noexcept { return size_ == 0; }
   DYNARRAY_NODISCARD DYNARRAY_CONSTEXPR size_type size() const noexcept { return size_; }
   DYNARRAY_NODISCARD DYNARRAY_CONSTEXPR static size_type max_size() noexcept {
-    return std::numeric_limits<difference_type>::max() / sizeof(value_type);
+    // limited by the size_type as well as by the difference_type of the iterators
+    return static_cast<std::uintmax_t>(std::numeric_limits<size_type>::max()) <
+                   static_cast<std::uintmax_t>(std::numeric_limits<difference_type>::max() / sizeof(value_type))
+               ? std::numeric_limits<size_type>::max()
+               : static_cast<size_type>(std::numeric_limits<difference_type>::max() / sizeof(value_type));
   }
 
   /**************************************************************************************************************************************/
   /**                                                            operations                                                            **/
   /**************************************************************************************************************************************/
   DYNARRAY_CONSTEXPR void swap(dynarray& other) noexcept {
-    std::swap(size_, other.size_);
-    std::swap(data_, other.data_);
+    assert((allocator_traits::propagate_on_container_swap::value || this->allocator() == other.allocator()) &&
+           "Swapping dynarrays with unequal allocators is undefined if the allocators aren't propagated!");
+    this->swap_storage(other);
+    if (allocator_traits::propagate_on_container_swap::value) {
+      using std::swap;
+      swap(this->allocator(), other.allocator());
+    }
+  }
+  // give up the ownership of the elements without destroying them, i.e., the caller must destroy them and deallocate the memory
+  // using get_allocator() (or the deleter of an adopted buffer); afterwards the dynarray is empty
+  DYNARRAY_NODISCARD DYNARRAY_CONSTEXPR pointer release() noexcept {
+    size_ = 0;
+    return detail::exchange(data_, nullptr);
   }
   DYNARRAY_CONSTEXPR void fill(const value_type& value = value_type{}) {
     assert((data_ != nullptr) && "Calling fill() is undefined for nullptr data!");
@@ -272,33 +1041,50 @@ class dynarray {
     assert((data_ != nullptr) && "Calling generate() is undefined for nullptr data!");
     std::generate(this->begin(), this->end(), gen);
   }
+  void fill(const parallel_policy& policy, const value_type& value = value_type{}) {
+    assert((data_ != nullptr) && "Calling fill() is undefined for nullptr data!");
+    detail::parallel_for_chunks(data_, size_, policy.num_threads(), [&](const size_type first, const size_type last) {
+      std::fill(data_ + first, data_ + last, value);
+    });
+  }
+  // the start value of each chunk is computed directly as value + first
+  void iota(const parallel_policy& policy, const value_type& value = value_type{}) {
+    assert((data_ != nullptr) && "Calling iota() is undefined for nullptr data!");
+    detail::parallel_for_chunks(data_, size_, policy.num_threads(), [&](const size_type first, const size_type last) {
+      std::iota(data_ + first, data_ + last, static_cast<value_type>(value + static_cast<value_type>(first)));
+    });
+  }
+  // the generator is called as gen(pos) for each position (concurrently, i.e., it must be thread-safe)
+  template <typename Generator>
+  void generate(const parallel_policy& policy, Generator gen) {
+    assert((data_ != nullptr) && "Calling generate() is undefined for nullptr data!");
+    detail::parallel_for_chunks(data_, size_, policy.num_threads(), [&](const size_type first, const size_type last) {
+      for (size_type pos = first; pos < last; ++pos) {
+        data_[pos] = gen(pos);
+      }
+    });
+  }
 
   /**************************************************************************************************************************************/
   /**                                                       non-member functions                                                       **/
   /**************************************************************************************************************************************/
+  // integral and byte element types are compared using std::memcmp or SSE2 (see detail::lexicographical_compare_bitwise)
 #if defined(__cpp_impl_three_way_comparison) && defined(__cpp_lib_three_way_comparison)
   DYNARRAY_NODISCARD DYNARRAY_CONSTEXPR friend bool operator==(const dynarray& lhs, const dynarray& rhs) noexcept {
-    return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    return lhs.size() == rhs.size() && detail::equal_elements(lhs.data(), rhs.data(), lhs.size(), detail::is_bitwise_comparable<T>{});
   }
   DYNARRAY_NODISCARD DYNARRAY_CONSTEXPR friend std::strong_ordering operator<=>(const dynarray& lhs, const dynarray& rhs) noexcept {
     return lhs.size() != rhs.size() ? lhs.size() <=> rhs.size()
-                                    : std::lexicographical_compare_three_way(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+                                    : detail::lexicographical_compare_three_way(lhs.data(), lhs.size(), rhs.data(), rhs.size(),
+                                                                                detail::is_bitwise_comparable<T>{});
   }
 #else
   DYNARRAY_NODISCARD DYNARRAY_CONSTEXPR friend bool operator==(const dynarray& lhs, const dynarray& rhs) noexcept {
-#if defined(__cpp_lib_robust_nonmodifying_seq_ops)
-    return std::equal(lhs.cbegin(), lhs.cend(), rhs.cbegin(), rhs.cend());
-#else
-    if (std::distance(lhs.cbegin(), lhs.cend()) != std::distance(rhs.cbegin(), rhs.cend())) {
-      return false;
-    } else {
-      return std::equal(lhs.cbegin(), lhs.cend(), rhs.cbegin());
-    }
-#endif
+    return lhs.size() == rhs.size() && detail::equal_elements(lhs.data(), rhs.data(), lhs.size(), detail::is_bitwise_comparable<T>{});
   }
   DYNARRAY_NODISCARD DYNARRAY_CONSTEXPR friend bool operator!=(const dynarray& lhs, const dynarray& rhs) noexcept { return !(lhs == rhs); }
   DYNARRAY_NODISCARD DYNARRAY_CONSTEXPR friend bool operator<(const dynarray& lhs, const dynarray& rhs) noexcept {
-    return std::lexicographical_compare(lhs.cbegin(), lhs.cend(), rhs.cbegin(), rhs.cend());
+    return detail::lexicographical_less(lhs.data(), lhs.size(), rhs.data(), rhs.size(), detail::is_bitwise_comparable<T>{});
   }
   DYNARRAY_NODISCARD DYNARRAY_CONSTEXPR friend bool operator>(const dynarray& lhs, const dynarray& rhs) noexcept { return rhs < lhs; }
   DYNARRAY_NODISCARD DYNARRAY_CONSTEXPR friend bool operator<=(const dynarray& lhs, const dynarray& rhs) noexcept { return !(rhs < lhs); }
@@ -306,24 +1092,182 @@ class dynarray {
 #endif
 
  private:
-  size_type size_{ 0 };
+  /**************************************************************************************************************************************/
+  /**                                                        memory management                                                         **/
+  /**************************************************************************************************************************************/
+  DYNARRAY_CONSTEXPR dynarray(allocator_type&& alloc, const pointer ptr, const size_type size) noexcept
+      : allocator_base(std::move(alloc)), data_{ ptr }, size_{ size } {}
+  DYNARRAY_NODISCARD DYNARRAY_CONSTEXPR static allocator_type adopting_allocator(const pointer ptr, const size_type size, std::true_type) {
+    return allocator_type(ptr, size);
+  }
+  DYNARRAY_NODISCARD DYNARRAY_CONSTEXPR static allocator_type adopting_allocator(pointer, size_type, std::false_type) {
+    return allocator_type();
+  }
+  DYNARRAY_NODISCARD DYNARRAY_CONSTEXPR pointer allocate_storage(const size_type size) {
+    return allocator_traits::allocate(this->allocator(), size);
+  }
+  // convert the size of a range to size_type throwing std::length_error if it would overflow
+  template <typename Size>
+  DYNARRAY_NODISCARD DYNARRAY_CONSTEXPR static size_type checked_size(const Size size) {
+    if (size < 0 || static_cast<std::uintmax_t>(size) > static_cast<std::uintmax_t>(max_size())) {
+      throw std::length_error{ "Range size exceeds max_size()" };
+    }
+    return static_cast<size_type>(size);
+  }
+  DYNARRAY_NODISCARD DYNARRAY_CONSTEXPR pointer allocate_storage(const size_type size, std::false_type) {
+    return this->allocate_storage(size);
+  }
+  DYNARRAY_NODISCARD pointer allocate_storage(const size_type size, std::true_type) { return this->allocator().allocate_zeroed(size); }
+  DYNARRAY_CONSTEXPR void deallocate_storage(pointer ptr, const size_type size) noexcept {
+    if (ptr != nullptr) {
+      allocator_traits::deallocate(this->allocator(), ptr, size);
+    }
+  }
+  // every element is constructed exactly once in the freshly allocated storage;
+  // allocator_traits::construct is used (instead of std::uninitialized_fill_n) to respect allocators customizing construct
+  template <typename... Args>
+  DYNARRAY_CONSTEXPR void construct_elements(const Args&... args) {
+    size_type constructed = 0;
+    try {
+      for (; constructed < size_; ++constructed) {
+        allocator_traits::construct(this->allocator(), data_ + constructed, args...);
+      }
+    } catch (...) {
+      this->handle_construction_failure(constructed);
+      throw;
+    }
+  }
+  DYNARRAY_CONSTEXPR void value_initialize_elements(std::false_type) { this->construct_elements(); }
+  void value_initialize_elements(std::true_type) noexcept {
+    // the allocator already provided zeroed memory
+  }
+  DYNARRAY_CONSTEXPR void default_initialize_elements() {
+    if (detail::is_constant_evaluated()) {
+      // uninitialized objects can't be used in constant expressions
+      this->construct_elements();
+    } else if (!std::is_trivially_default_constructible<value_type>::value) {
+      this->default_initialize_elements(detail::uses_default_construct<allocator_type, value_type>{});
+    }
+  }
+  DYNARRAY_CONSTEXPR void default_initialize_elements(std::false_type) {
+    // the allocator customizes construct (e.g., uses-allocator construction) -> the elements must be constructed through it
+    this->construct_elements();
+  }
+  void default_initialize_elements(std::true_type) {
+    size_type constructed = 0;
+    try {
+      for (; constructed < size_; ++constructed) {
+        ::new (static_cast<void*>(data_ + constructed)) value_type;
+      }
+    } catch (...) {
+      this->handle_construction_failure(constructed);
+      throw;
+    }
+  }
+  template <typename InputIt>
+  DYNARRAY_CONSTEXPR void construct_elements_from(InputIt first) {
+    this->construct_elements_from(first, is_bitwise_constructible_from<InputIt>{});
+  }
+  template <typename InputIt>
+  DYNARRAY_CONSTEXPR void construct_elements_from(InputIt first, std::true_type) {
+    if (detail::is_constant_evaluated()) {
+      this->construct_elements_from(first, std::false_type{});
+    } else if (size_ != 0) {
+      std::memcpy(data_, detail::to_address(first), size_ * sizeof(value_type));
+    }
+  }
+  template <typename InputIt>
+  DYNARRAY_CONSTEXPR void construct_elements_from(InputIt first, std::false_type) {
+    size_type constructed = 0;
+    try {
+      for (; constructed < size_; ++constructed, ++first) {
+        allocator_traits::construct(this->allocator(), data_ + constructed, *first);
+      }
+    } catch (...) {
+      this->handle_construction_failure(constructed);
+      throw;
+    }
+  }
+  DYNARRAY_CONSTEXPR void handle_construction_failure(const size_type constructed) noexcept {
+    // the destructor won't run for a partially constructed dynarray -> clean up before rethrowing
+    this->destroy_elements(data_, data_ + constructed);
+    this->deallocate_storage(data_, size_);
+  }
+  template <typename ForwardIt>
+  DYNARRAY_CONSTEXPR void copy_assign_elements(ForwardIt first, ForwardIt last) {
+    this->copy_assign_elements(first, last, is_bitwise_assignable_from<ForwardIt>{});
+  }
+  template <typename ForwardIt>
+  DYNARRAY_CONSTEXPR void copy_assign_elements(ForwardIt first, ForwardIt last, std::true_type) {
+    if (detail::is_constant_evaluated()) {
+      std::copy(first, last, this->begin());
+    } else if (size_ != 0) {
+      // the source range may alias our own elements
+      std::memmove(data_, detail::to_address(first), size_ * sizeof(value_type));
+    }
+  }
+  template <typename ForwardIt>
+  DYNARRAY_CONSTEXPR void copy_assign_elements(ForwardIt first, ForwardIt last, std::false_type) {
+    std::copy(first, last, this->begin());
+  }
+  DYNARRAY_CONSTEXPR void destroy_elements(pointer first, pointer last) noexcept {
+    for (; first != last; ++first) {
+      allocator_traits::destroy(this->allocator(), first);
+    }
+  }
+
+  DYNARRAY_CONSTEXPR void swap_storage(dynarray& other) noexcept {
+    std::swap(size_, other.size_);
+    std::swap(data_, other.data_);
+  }
+  DYNARRAY_CONSTEXPR void propagate_allocator(const dynarray& other, std::true_type) noexcept { this->allocator() = other.allocator(); }
+  DYNARRAY_CONSTEXPR void propagate_allocator(const dynarray&, std::false_type) noexcept {}
+
   pointer data_{ nullptr };
+  size_type size_{ 0 };
 };
 
-template <typename T>
-DYNARRAY_CONSTEXPR void swap(dynarray<T>& lhs, dynarray<T>& rhs) noexcept { lhs.swap(rhs); }
+template <typename T, typename Allocator, typename SizeType>
+DYNARRAY_CONSTEXPR void swap(dynarray<T, Allocator, SizeType>& lhs, dynarray<T, Allocator, SizeType>& rhs) noexcept {
+  lhs.swap(rhs);
+}
+
+/**
+ * @brief A cpp_util::dynarray whose data() is aligned to @p Alignment bytes (see cpp_util::aligned_allocator).
+ */
+template <typename T, std::size_t Alignment = detail::cache_line_size, bool PadToAlignment = false>
+using aligned_dynarray = dynarray<T, aligned_allocator<T, Alignment, PadToAlignment>>;
+
+#if defined(__cpp_lib_memory_resource)
+namespace pmr {
+
+/**
+ * @brief A cpp_util::dynarray using a `std::pmr::polymorphic_allocator`, i.e., the `std::pmr::memory_resource` is selected at runtime.
+ *        The elements are constructed using uses-allocator construction, e.g., the elements of a
+ *        `cpp_util::pmr::dynarray<std::pmr::string>` or `cpp_util::pmr::dynarray<cpp_util::pmr::dynarray<T>>` use the same memory resource.
+ */
+template <typename T, typename SizeType = std::size_t>
+using dynarray = cpp_util::dynarray<T, std::pmr::polymorphic_allocator<T>, SizeType>;
+
+}  // namespace pmr
+#endif
 
 /****************************************************************************************************************************************/
 /**                                                          deduction guides                                                          **/
 /****************************************************************************************************************************************/
 #if defined(__cpp_deduction_guides)
-template <typename ForwardIt>
-dynarray(ForwardIt, ForwardIt) -> dynarray<typename std::iterator_traits<ForwardIt>::value_type>;
+template <typename ForwardIt, typename Allocator = std::allocator<typename std::iterator_traits<ForwardIt>::value_type>>
+dynarray(ForwardIt, ForwardIt, Allocator = Allocator()) -> dynarray<typename std::iterator_traits<ForwardIt>::value_type, Allocator>;
 #endif
 
 }  // namespace cpp_util
 
-#undef DYNARRAY_NODISCARD
-#undef DYNARRAY_CONSTEXPR
+#if defined(__cpp_lib_ranges)
+// a cpp_util::row_view doesn't own its elements, i.e., it can be converted to a std::span even if it is a temporary
+template <typename T>
+inline constexpr bool std::ranges::enable_borrowed_range<cpp_util::row_view<T>> = true;
+#endif
+
+#undef DYNARRAY_HAS_SSE2
 
 #endif  // CPP_UTIL_DYNARRAY_HPP
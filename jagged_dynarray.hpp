@@ -0,0 +1,259 @@
+/**
+ * Copyright (C) 2021 - Marcel Breyer - All Rights Reserved
+ * Licensed under the MIT License. See LICENSE.md file in the project root for full license information.
+ *
+ * Implements a jagged array of rows with runtime fixed sizes stored in a single contiguous buffer (CSR layout).
+ */
+
+#ifndef CPP_UTIL_JAGGED_DYNARRAY_HPP
+#define CPP_UTIL_JAGGED_DYNARRAY_HPP
+
+#include "dynarray.hpp"
+
+#include <cassert>           // assert
+#include <cstddef>           // std::size_t, std::ptrdiff_t
+#include <initializer_list>  // std::initializer_list
+#include <iterator>          // std::distance, std::iterator_traits, std::forward_iterator_tag, std::input_iterator_tag
+#include <memory>            // std::allocator, std::allocator_traits
+#include <stdexcept>         // std::out_of_range
+#include <type_traits>       // std::enable_if, std::is_convertible
+
+namespace cpp_util {
+
+/**
+ * @brief A jagged array: a runtime fixed number of rows with runtime fixed, possibly different sizes. All values are stored in a single
+ *        contiguous cpp_util::dynarray, the start of each row in a second cpp_util::dynarray of `size() + 1` offsets (CSR layout),
+ *        i.e., constructing the array needs two allocations independent of the number of rows and scanning all values is sequential.
+ */
+template <typename T, typename Allocator = std::allocator<T>>
+class jagged_dynarray {
+  using offsets_allocator_type = typename std::allocator_traits<Allocator>::template rebind_alloc<std::size_t>;
+
+ public:
+  using value_type = T;
+  using allocator_type = Allocator;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using values_type = dynarray<value_type, allocator_type>;
+  using offsets_type = dynarray<size_type, offsets_allocator_type>;
+  using row_type = row_view<value_type>;
+  using const_row_type = row_view<const value_type>;
+
+  /**
+   * @brief Iterator over the rows of a cpp_util::jagged_dynarray yielding a cpp_util::row_view per row.
+   */
+  template <typename Row>
+  class row_iterator {
+   public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = Row;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = Row;
+
+    row_iterator() = default;
+    row_iterator(typename Row::pointer values, const size_type* offsets) noexcept : values_{ values }, offsets_{ offsets } {}
+
+    DYNARRAY_NODISCARD reference operator*() const noexcept { return Row{ values_ + offsets_[0], offsets_[1] - offsets_[0] }; }
+    row_iterator& operator++() noexcept {
+      ++offsets_;
+      return *this;
+    }
+    row_iterator operator++(int) noexcept {
+      row_iterator tmp{ *this };
+      ++offsets_;
+      return tmp;
+    }
+
+    DYNARRAY_NODISCARD friend bool operator==(const row_iterator& lhs, const row_iterator& rhs) noexcept { return lhs.offsets_ == rhs.offsets_; }
+    DYNARRAY_NODISCARD friend bool operator!=(const row_iterator& lhs, const row_iterator& rhs) noexcept { return !(lhs == rhs); }
+
+   private:
+    typename Row::pointer values_{ nullptr };
+    const size_type* offsets_{ nullptr };
+  };
+  using iterator = row_iterator<row_type>;
+  using const_iterator = row_iterator<const_row_type>;
+
+  /**************************************************************************************************************************************/
+  /**                                                           construction                                                           **/
+  /**************************************************************************************************************************************/
+  jagged_dynarray() : jagged_dynarray(allocator_type()) {}
+  explicit jagged_dynarray(const allocator_type& alloc) : offsets_(1, size_type{ 0 }, offsets_allocator_type(alloc)), values_(alloc) {}
+  // construct the rows with the sizes given by the range [first_size, last_size); all values are value-initialized
+  template <typename ForwardIt, typename std::enable_if<std::is_convertible<typename std::iterator_traits<ForwardIt>::iterator_category,
+                                                                            std::forward_iterator_tag>::value,
+                                                        bool>::type = true>
+  jagged_dynarray(ForwardIt first_size, ForwardIt last_size, const allocator_type& alloc = allocator_type())
+      : offsets_{ make_offsets(first_size, last_size, alloc) }, values_(offsets_.back(), value_init, alloc) {}
+  template <typename ForwardIt, typename std::enable_if<std::is_convertible<typename std::iterator_traits<ForwardIt>::iterator_category,
+                                                                            std::forward_iterator_tag>::value,
+                                                        bool>::type = true>
+  jagged_dynarray(ForwardIt first_size, ForwardIt last_size, for_overwrite_t, const allocator_type& alloc = allocator_type())
+      : offsets_{ make_offsets(first_size, last_size, alloc) }, values_(offsets_.back(), for_overwrite, alloc) {}
+  template <typename ForwardIt, typename std::enable_if<std::is_convertible<typename std::iterator_traits<ForwardIt>::iterator_category,
+                                                                            std::forward_iterator_tag>::value,
+                                                        bool>::type = true>
+  jagged_dynarray(ForwardIt first_size, ForwardIt last_size, const value_type& init, const allocator_type& alloc = allocator_type())
+      : offsets_{ make_offsets(first_size, last_size, alloc) }, values_(offsets_.back(), init, alloc) {}
+  // construct the rows from nested initializer lists, e.g., { { 1, 2 }, { 3 }, { } }
+  jagged_dynarray(std::initializer_list<std::initializer_list<value_type>> rows, const allocator_type& alloc = allocator_type())
+      : offsets_{ make_offsets(rows, alloc) },
+        values_(nested_iterator{ rows.begin(), rows.end() }, nested_iterator{ rows.end(), rows.end() }, alloc) {}
+
+  DYNARRAY_NODISCARD allocator_type get_allocator() const noexcept { return values_.get_allocator(); }
+
+  /**************************************************************************************************************************************/
+  /**                                                          element access                                                          **/
+  /**************************************************************************************************************************************/
+  DYNARRAY_NODISCARD row_type at(const size_type row) {
+    if (row >= this->size()) throw std::out_of_range{ "Index out-of-range: row >= this->size()" };
+    return (*this)[row];
+  }
+  DYNARRAY_NODISCARD const_row_type at(const size_type row) const {
+    if (row >= this->size()) throw std::out_of_range{ "Index out-of-range: row >= this->size()" };
+    return (*this)[row];
+  }
+  DYNARRAY_NODISCARD row_type operator[](const size_type row) {
+    assert((row < this->size()) && "Undefined behavior if row >= this->size()!");
+    return row_type{ values_.data() + offsets_[row], offsets_[row + 1] - offsets_[row] };
+  }
+  DYNARRAY_NODISCARD const_row_type operator[](const size_type row) const {
+    assert((row < this->size()) && "Undefined behavior if row >= this->size()!");
+    return const_row_type{ values_.data() + offsets_[row], offsets_[row + 1] - offsets_[row] };
+  }
+  DYNARRAY_NODISCARD size_type row_size(const size_type row) const {
+    assert((row < this->size()) && "Undefined behavior if row >= this->size()!");
+    return offsets_[row + 1] - offsets_[row];
+  }
+  // all values of all rows, row after row
+  DYNARRAY_NODISCARD values_type& values() noexcept { return values_; }
+  DYNARRAY_NODISCARD const values_type& values() const noexcept { return values_; }
+  // the start of the row i in values() is offsets()[i], the end offsets()[i + 1] (empty after the jagged_dynarray has been moved from)
+  DYNARRAY_NODISCARD const offsets_type& offsets() const noexcept { return offsets_; }
+
+  /**************************************************************************************************************************************/
+  /**                                                         iterator support                                                         **/
+  /**************************************************************************************************************************************/
+  DYNARRAY_NODISCARD iterator begin() noexcept { return iterator{ values_.data(), offsets_.data() }; }
+  DYNARRAY_NODISCARD iterator end() noexcept { return iterator{ values_.data(), offsets_.data() + this->size() }; }
+  DYNARRAY_NODISCARD const_iterator begin() const noexcept { return const_iterator{ values_.data(), offsets_.data() }; }
+  DYNARRAY_NODISCARD const_iterator end() const noexcept { return const_iterator{ values_.data(), offsets_.data() + this->size() }; }
+  DYNARRAY_NODISCARD const_iterator cbegin() const noexcept { return this->begin(); }
+  DYNARRAY_NODISCARD const_iterator cend() const noexcept { return this->end(); }
+
+  /**************************************************************************************************************************************/
+  /**                                                             capacity                                                             **/
+  /**************************************************************************************************************************************/
+  // the number of rows; a moved-from jagged_dynarray has no offsets at all and is empty
+  DYNARRAY_NODISCARD bool empty() const noexcept { return this->size() == 0; }
+  DYNARRAY_NODISCARD size_type size() const noexcept { return offsets_.empty() ? 0 : offsets_.size() - 1; }
+  // the total number of values in all rows
+  DYNARRAY_NODISCARD size_type num_values() const noexcept { return values_.size(); }
+
+  /**************************************************************************************************************************************/
+  /**                                                            operations                                                            **/
+  /**************************************************************************************************************************************/
+  void swap(jagged_dynarray& other) noexcept {
+    offsets_.swap(other.offsets_);
+    values_.swap(other.values_);
+  }
+  // operate on all values of all rows (use operator[] to operate on a single row)
+  void fill(const value_type& value = value_type{}) { values_.fill(value); }
+  void iota(const value_type& value = value_type{}) { values_.iota(value); }
+  template <typename Generator>
+  void generate(Generator gen) {
+    values_.generate(gen);
+  }
+  void fill(const parallel_policy& policy, const value_type& value = value_type{}) { values_.fill(policy, value); }
+  void iota(const parallel_policy& policy, const value_type& value = value_type{}) { values_.iota(policy, value); }
+  template <typename Generator>
+  void generate(const parallel_policy& policy, Generator gen) {
+    values_.generate(policy, gen);
+  }
+
+  DYNARRAY_NODISCARD friend bool operator==(const jagged_dynarray& lhs, const jagged_dynarray& rhs) {
+    return lhs.size() == rhs.size() && (lhs.empty() || lhs.offsets_ == rhs.offsets_) && lhs.values_ == rhs.values_;
+  }
+  DYNARRAY_NODISCARD friend bool operator!=(const jagged_dynarray& lhs, const jagged_dynarray& rhs) { return !(lhs == rhs); }
+
+ private:
+  // iterates over all values of nested initializer lists
+  class nested_iterator {
+    using outer_iterator = typename std::initializer_list<std::initializer_list<T>>::iterator;
+
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T*;
+    using reference = const T&;
+
+    nested_iterator() = default;
+    nested_iterator(outer_iterator outer, outer_iterator outer_end) : outer_{ outer }, outer_end_{ outer_end } { this->skip_empty_rows(); }
+
+    reference operator*() const { return *inner_; }
+    nested_iterator& operator++() {
+      if (++inner_ == outer_->end()) {
+        ++outer_;
+        this->skip_empty_rows();
+      }
+      return *this;
+    }
+    nested_iterator operator++(int) {
+      nested_iterator tmp{ *this };
+      ++*this;
+      return tmp;
+    }
+
+    friend bool operator==(const nested_iterator& lhs, const nested_iterator& rhs) {
+      return lhs.outer_ == rhs.outer_ && (lhs.outer_ == lhs.outer_end_ || lhs.inner_ == rhs.inner_);
+    }
+    friend bool operator!=(const nested_iterator& lhs, const nested_iterator& rhs) { return !(lhs == rhs); }
+
+   private:
+    void skip_empty_rows() {
+      while (outer_ != outer_end_ && outer_->size() == 0) {
+        ++outer_;
+      }
+      inner_ = outer_ != outer_end_ ? outer_->begin() : nullptr;
+    }
+
+    outer_iterator outer_{ nullptr };
+    outer_iterator outer_end_{ nullptr };
+    const T* inner_{ nullptr };
+  };
+
+  // the exclusive prefix sum of the row sizes
+  template <typename ForwardIt>
+  static offsets_type make_offsets(ForwardIt first_size, ForwardIt last_size, const allocator_type& alloc) {
+    offsets_type offsets(static_cast<size_type>(std::distance(first_size, last_size)) + 1, for_overwrite, offsets_allocator_type(alloc));
+    offsets[0] = 0;
+    for (size_type row = 1; first_size != last_size; ++first_size, ++row) {
+      offsets[row] = offsets[row - 1] + static_cast<size_type>(*first_size);
+    }
+    return offsets;
+  }
+  static offsets_type make_offsets(std::initializer_list<std::initializer_list<value_type>> rows, const allocator_type& alloc) {
+    offsets_type offsets(rows.size() + 1, for_overwrite, offsets_allocator_type(alloc));
+    offsets[0] = 0;
+    size_type row = 1;
+    for (const std::initializer_list<value_type>& values : rows) {
+      offsets[row] = offsets[row - 1] + values.size();
+      ++row;
+    }
+    return offsets;
+  }
+
+  offsets_type offsets_;
+  values_type values_;
+};
+
+template <typename T, typename Allocator>
+void swap(jagged_dynarray<T, Allocator>& lhs, jagged_dynarray<T, Allocator>& rhs) noexcept {
+  lhs.swap(rhs);
+}
+
+}  // namespace cpp_util
+
+#endif  // CPP_UTIL_JAGGED_DYNARRAY_HPP
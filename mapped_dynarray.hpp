@@ -0,0 +1,615 @@
+/**
+ * Copyright (C) 2021 - Marcel Breyer - All Rights Reserved
+ * Licensed under the MIT License. See LICENSE.md file in the project root for full license information.
+ *
+ * Implements memory mapped cpp_util::dynarray variants over files in the binary format of cpp_util::write_binary: a read-only view of
+ * an existing file and a writable, file-backed array for data sets larger than the main memory.
+ */
+
+#ifndef CPP_UTIL_MAPPED_DYNARRAY_HPP
+#define CPP_UTIL_MAPPED_DYNARRAY_HPP
+
+#include "binary_io.hpp"
+#include "dynarray.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#include <algorithm>     // std::fill, std::generate
+#include <cassert>       // assert
+#include <cerrno>        // errno, EOPNOTSUPP
+#include <cstddef>       // std::size_t, std::ptrdiff_t
+#include <cstdint>       // std::uint64_t
+#include <cstring>       // std::memcpy
+#include <iterator>      // std::reverse_iterator
+#include <limits>        // std::numeric_limits
+#include <numeric>       // std::iota
+#include <stdexcept>     // std::out_of_range, std::runtime_error, std::length_error
+#include <string>        // std::string
+#include <system_error>  // std::system_error, std::generic_category
+#include <type_traits>   // std::is_trivially_copyable
+#include <utility>       // std::move, std::swap
+
+#if __has_include(<compare>)
+#include <compare>  // std::strong_ordering
+#endif
+
+#include <fcntl.h>     // ::open, ::fallocate, O_RDONLY, O_RDWR, O_CREAT, O_TRUNC, O_CLOEXEC
+#include <sys/mman.h>  // ::mmap, ::munmap, ::madvise, ::msync
+#include <sys/stat.h>  // ::fstat
+#include <unistd.h>    // ::close, ::ftruncate
+
+namespace cpp_util {
+
+/**
+ * @brief How the pages of a cpp_util::mapped_dynarray are loaded.
+ */
+enum class map_prefetch {
+  /// pages are loaded lazily on first access
+  none,
+  /// all pages are loaded before the constructor returns (`MAP_POPULATE`; `madvise(MADV_WILLNEED)` if not supported)
+  populate,
+  /// the kernel starts reading all pages asynchronously in the background (`madvise(MADV_WILLNEED)`)
+  will_need
+};
+
+/**
+ * @brief Access pattern hints for a writable cpp_util::mapped_dynarray (passed to `madvise`).
+ */
+enum class map_advice {
+  /// no special treatment
+  normal,
+  /// the pages are accessed in order, i.e., aggressive read-ahead and early reclaim of accessed pages (`MADV_SEQUENTIAL`)
+  sequential,
+  /// the pages are accessed in random order, i.e., no read-ahead (`MADV_RANDOM`)
+  random,
+  /// the pages will be accessed soon (`MADV_WILLNEED`)
+  will_need,
+  /// the pages won't be accessed in the near future, i.e., they may be written back and reclaimed (`MADV_DONTNEED`)
+  dont_need
+};
+
+namespace detail {
+
+/**
+ * @brief Owns a shared or private memory mapping of a whole file. The file descriptor is closed directly after mapping the file.
+ */
+class file_mapping {
+ public:
+  file_mapping() noexcept = default;
+  // maps the existing file @p path
+  file_mapping(const std::string& path, const bool writable, const map_prefetch prefetch) {
+    const int fd = ::open(path.c_str(), (writable ? O_RDWR : O_RDONLY) | O_CLOEXEC);
+    if (fd < 0) {
+      throw std::system_error{ errno, std::generic_category(), "Failed to open " + path };
+    }
+    struct ::stat status {};
+    if (::fstat(fd, &status) != 0) {
+      const int error = errno;
+      ::close(fd);
+      throw std::system_error{ error, std::generic_category(), "Failed to query the size of " + path };
+    }
+    size_ = static_cast<std::size_t>(status.st_size);
+    if (size_ < sizeof(binary_header)) {
+      ::close(fd);
+      throw std::runtime_error{ "Invalid cpp_util::dynarray binary header" };
+    }
+    this->map(fd, path, writable, prefetch);
+  }
+  // creates (or truncates) the file @p path with @p size bytes; the file is sparse unless @p preallocate is `true`
+  file_mapping(const std::string& path, const std::size_t size, const bool preallocate) : size_{ size } {
+    const int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) {
+      throw std::system_error{ errno, std::generic_category(), "Failed to create " + path };
+    }
+    if (::ftruncate(fd, static_cast< ::off_t>(size)) != 0) {
+      const int error = errno;
+      ::close(fd);
+      throw std::system_error{ error, std::generic_category(), "Failed to resize " + path };
+    }
+#if defined(__linux__)
+    // reserve the disk blocks up front, i.e., writing to the mapping can't fail with SIGBUS because the disk is full
+    if (preallocate && ::fallocate(fd, 0, 0, static_cast< ::off_t>(size)) != 0 && errno != EOPNOTSUPP) {
+      const int error = errno;
+      ::close(fd);
+      throw std::system_error{ error, std::generic_category(), "Failed to preallocate " + path };
+    }
+#else
+    static_cast<void>(preallocate);
+#endif
+    this->map(fd, path, true, map_prefetch::none);
+  }
+  // shares the first @p size bytes of the file (or shared memory object) @p fd; the mapping keeps the object alive, i.e., the caller
+  // still owns @p fd and may close it afterwards
+  file_mapping(const int fd, const std::size_t size, const bool writable) : size_{ size } {
+    void* ptr = ::mmap(nullptr, size_, writable ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, fd, 0);
+    if (ptr == MAP_FAILED) {
+      throw std::system_error{ errno, std::generic_category(), "Failed to map the shared memory" };
+    }
+    data_ = ptr;
+  }
+  file_mapping(const file_mapping&) = delete;
+  file_mapping(file_mapping&& other) noexcept
+      : data_{ detail::exchange(other.data_, nullptr) }, size_{ detail::exchange(other.size_, std::size_t{ 0 }) } {}
+  ~file_mapping() {
+    if (data_ != nullptr) {
+      ::munmap(data_, size_);
+    }
+  }
+  file_mapping& operator=(const file_mapping&) = delete;
+  file_mapping& operator=(file_mapping&& other) noexcept {
+    file_mapping tmp{ std::move(other) };
+    this->swap(tmp);
+    return *this;
+  }
+
+  DYNARRAY_NODISCARD unsigned char* data() const noexcept { return static_cast<unsigned char*>(data_); }
+  DYNARRAY_NODISCARD std::size_t size() const noexcept { return size_; }
+
+  void swap(file_mapping& other) noexcept {
+    std::swap(data_, other.data_);
+    std::swap(size_, other.size_);
+  }
+
+ private:
+  void map(const int fd, const std::string& path, const bool writable, const map_prefetch prefetch) {
+    int flags = writable ? MAP_SHARED : MAP_PRIVATE;
+#if defined(MAP_POPULATE)
+    if (prefetch == map_prefetch::populate) {
+      flags |= MAP_POPULATE;
+    }
+#endif
+    void* ptr = ::mmap(nullptr, size_, writable ? PROT_READ | PROT_WRITE : PROT_READ, flags, fd, 0);
+    const int error = errno;
+    // the mapping keeps the file open
+    ::close(fd);
+    if (ptr == MAP_FAILED) {
+      throw std::system_error{ error, std::generic_category(), "Failed to map " + path };
+    }
+    data_ = ptr;
+#if defined(MAP_POPULATE)
+    if (prefetch == map_prefetch::will_need) {
+#else
+    if (prefetch != map_prefetch::none) {
+#endif
+      // only a hint
+      ::madvise(data_, size_, MADV_WILLNEED);
+    }
+  }
+
+  void* data_{ nullptr };
+  std::size_t size_{ 0 };
+};
+
+// validates the header at the start of @p mapping and returns it
+template <typename T>
+binary_header mapped_binary_header(const file_mapping& mapping) {
+  binary_header header{};
+  std::memcpy(&header, mapping.data(), sizeof(header));
+  if (check_binary_header<T>(header)) {
+    throw std::runtime_error{ "Can't map a cpp_util::dynarray written with the opposite byte order" };
+  }
+  const std::size_t payload = mapping.size() - sizeof(header);
+  if (header.count != payload / sizeof(T) || payload % sizeof(T) != 0) {
+    throw std::runtime_error{ "The file size doesn't match the number of elements of the cpp_util::dynarray binary header" };
+  }
+  return header;
+}
+
+}  // namespace detail
+
+/**
+ * @brief A cpp_util::dynarray whose elements are a shared memory mapping of a file in the binary format of cpp_util::write_binary, i.e.,
+ *        the array may be larger than the main memory and all modifications are written to the file by the operating system.
+ *        Newly created files are sparse: the elements are zero bytes and disk blocks are only allocated once a page is written
+ *        (unless requested up front). flush() updates the checksum in the header and synchronously writes all modified pages to disk;
+ *        without a final flush() the pages are still written back by the operating system, but the checksum in the header is stale.
+ */
+template <typename T>
+class mapped_dynarray;
+
+/**
+ * @brief A read-only cpp_util::dynarray whose elements are a private memory mapping of a file written by cpp_util::write_binary.
+ *        Opening the file only validates the header, i.e., it is independent of the file size; the pages are loaded lazily on first
+ *        access (or prefetched as requested by cpp_util::map_prefetch). The checksum isn't verified automatically since that would
+ *        touch every page; call verify() to do so.
+ */
+template <typename T>
+class mapped_dynarray<const T> {
+ public:
+  /**************************************************************************************************************************************/
+  /**                                                              types                                                               **/
+  /**************************************************************************************************************************************/
+  using value_type = T;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = const value_type&;
+  using const_reference = const value_type&;
+  using pointer = const value_type*;
+  using const_pointer = const value_type*;
+  using iterator = const_pointer;
+  using const_iterator = const_pointer;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable elements can be memory mapped");
+  static_assert(alignof(T) <= sizeof(detail::binary_header), "The elements in the memory mapped file are only aligned to 64 bytes");
+
+  /**************************************************************************************************************************************/
+  /**                                                           construction                                                           **/
+  /**************************************************************************************************************************************/
+  mapped_dynarray() noexcept = default;
+  /**
+   * @brief Maps the file @p path written by cpp_util::write_binary.
+   * @throws std::system_error if the file can't be opened or mapped
+   * @throws std::runtime_error if the header doesn't match @p T, the file has the opposite byte order, or the file size doesn't match
+   */
+  explicit mapped_dynarray(const std::string& path, const map_prefetch prefetch = map_prefetch::none)
+      : mapping_(path, false, prefetch) {
+    const detail::binary_header header = detail::mapped_binary_header<T>(mapping_);
+    data_ = reinterpret_cast<const_pointer>(mapping_.data() + sizeof(header));
+    size_ = static_cast<size_type>(header.count);
+    checksum_ = header.checksum;
+  }
+  mapped_dynarray(const mapped_dynarray&) = delete;
+  mapped_dynarray(mapped_dynarray&& other) noexcept
+      : mapping_(std::move(other.mapping_)),
+        data_{ detail::exchange(other.data_, nullptr) },
+        size_{ detail::exchange(other.size_, size_type{ 0 }) },
+        checksum_{ other.checksum_ } {}
+
+  /**************************************************************************************************************************************/
+  /**                                                            assignment                                                            **/
+  /**************************************************************************************************************************************/
+  mapped_dynarray& operator=(const mapped_dynarray&) = delete;
+  mapped_dynarray& operator=(mapped_dynarray&& other) noexcept {
+    mapped_dynarray tmp{ std::move(other) };
+    this->swap(tmp);
+    return *this;
+  }
+
+  /**************************************************************************************************************************************/
+  /**                                                          element access                                                          **/
+  /**************************************************************************************************************************************/
+  DYNARRAY_NODISCARD const_reference at(const size_type pos) const {
+    if (pos >= size_) throw std::out_of_range{ "Index out-of-range: pos >= this->size()" };
+    return data_[pos];
+  }
+  DYNARRAY_NODISCARD const_reference operator[](const size_type pos) const {
+    assert((pos < size_) && "Undefined behavior if pos >= this->size()!");
+    return data_[pos];
+  }
+  DYNARRAY_NODISCARD const_reference front() const {
+    assert((!this->empty()) && "Calling front() is undefined for empty dynarrays!");
+    return data_[0];
+  }
+  DYNARRAY_NODISCARD const_reference back() const {
+    assert((!this->empty()) && "Calling back() is undefined for empty dynarrays!");
+    return data_[size_ - 1];
+  }
+  DYNARRAY_NODISCARD const_pointer data() const noexcept { return data_; }
+
+  /**************************************************************************************************************************************/
+  /**                                                         iterator support                                                         **/
+  /**************************************************************************************************************************************/
+  DYNARRAY_NODISCARD const_iterator begin() const noexcept { return data_; }
+  DYNARRAY_NODISCARD const_iterator end() const noexcept { return data_ + size_; }
+  DYNARRAY_NODISCARD const_iterator cbegin() const noexcept { return data_; }
+  DYNARRAY_NODISCARD const_iterator cend() const noexcept { return data_ + size_; }
+  DYNARRAY_NODISCARD const_reverse_iterator rbegin() const noexcept { return detail::make_reverse_iterator(this->end()); }
+  DYNARRAY_NODISCARD const_reverse_iterator rend() const noexcept { return detail::make_reverse_iterator(this->begin()); }
+  DYNARRAY_NODISCARD const_reverse_iterator crbegin() const noexcept { return detail::make_reverse_iterator(this->end()); }
+  DYNARRAY_NODISCARD const_reverse_iterator crend() const noexcept { return detail::make_reverse_iterator(this->begin()); }
+
+  /**************************************************************************************************************************************/
+  /**                                                             capacity                                                             **/
+  /**************************************************************************************************************************************/
+  DYNARRAY_NODISCARD bool empty() const noexcept { return size_ == 0; }
+  DYNARRAY_NODISCARD size_type size() const noexcept { return size_; }
+
+  /**************************************************************************************************************************************/
+  /**                                                            operations                                                            **/
+  /**************************************************************************************************************************************/
+  void swap(mapped_dynarray& other) noexcept {
+    mapping_.swap(other.mapping_);
+    std::swap(data_, other.data_);
+    std::swap(size_, other.size_);
+    std::swap(checksum_, other.checksum_);
+  }
+  // compares the checksum stored in the header with the elements (reads the whole file)
+  DYNARRAY_NODISCARD bool verify() const noexcept { return detail::xxh64::hash(data_, size_ * sizeof(T)) == checksum_; }
+
+  /**************************************************************************************************************************************/
+  /**                                                       non-member functions                                                       **/
+  /**************************************************************************************************************************************/
+#if defined(__cpp_impl_three_way_comparison) && defined(__cpp_lib_three_way_comparison)
+  DYNARRAY_NODISCARD friend bool operator==(const mapped_dynarray& lhs, const mapped_dynarray& rhs) noexcept {
+    return lhs.size() == rhs.size() && detail::equal_elements(lhs.data(), rhs.data(), lhs.size(), detail::is_bitwise_comparable<T>{});
+  }
+  DYNARRAY_NODISCARD friend std::strong_ordering operator<=>(const mapped_dynarray& lhs, const mapped_dynarray& rhs) noexcept {
+    return lhs.size() != rhs.size() ? lhs.size() <=> rhs.size()
+                                    : detail::lexicographical_compare_three_way(lhs.data(), lhs.size(), rhs.data(), rhs.size(),
+                                                                                detail::is_bitwise_comparable<T>{});
+  }
+#else
+  DYNARRAY_NODISCARD friend bool operator==(const mapped_dynarray& lhs, const mapped_dynarray& rhs) noexcept {
+    return lhs.size() == rhs.size() && detail::equal_elements(lhs.data(), rhs.data(), lhs.size(), detail::is_bitwise_comparable<T>{});
+  }
+  DYNARRAY_NODISCARD friend bool operator!=(const mapped_dynarray& lhs, const mapped_dynarray& rhs) noexcept { return !(lhs == rhs); }
+  DYNARRAY_NODISCARD friend bool operator<(const mapped_dynarray& lhs, const mapped_dynarray& rhs) noexcept {
+    return detail::lexicographical_less(lhs.data(), lhs.size(), rhs.data(), rhs.size(), detail::is_bitwise_comparable<T>{});
+  }
+  DYNARRAY_NODISCARD friend bool operator>(const mapped_dynarray& lhs, const mapped_dynarray& rhs) noexcept { return rhs < lhs; }
+  DYNARRAY_NODISCARD friend bool operator<=(const mapped_dynarray& lhs, const mapped_dynarray& rhs) noexcept { return !(rhs < lhs); }
+  DYNARRAY_NODISCARD friend bool operator>=(const mapped_dynarray& lhs, const mapped_dynarray& rhs) noexcept { return !(lhs < rhs); }
+#endif
+
+ private:
+  detail::file_mapping mapping_;
+  const_pointer data_{ nullptr };
+  size_type size_{ 0 };
+  std::uint64_t checksum_{ 0 };
+};
+
+template <typename T>
+void swap(mapped_dynarray<const T>& lhs, mapped_dynarray<const T>& rhs) noexcept {
+  lhs.swap(rhs);
+}
+
+template <typename T>
+class mapped_dynarray {
+ public:
+  /**************************************************************************************************************************************/
+  /**                                                              types                                                               **/
+  /**************************************************************************************************************************************/
+  using value_type = T;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using pointer = value_type*;
+  using const_pointer = const value_type*;
+  using iterator = pointer;
+  using const_iterator = const_pointer;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable elements can be memory mapped");
+  static_assert(alignof(T) <= sizeof(detail::binary_header), "The elements in the memory mapped file are only aligned to 64 bytes");
+
+  /**************************************************************************************************************************************/
+  /**                                                           construction                                                           **/
+  /**************************************************************************************************************************************/
+  mapped_dynarray() noexcept = default;
+  /**
+   * @brief Creates (or truncates) the file @p path with room for @p size elements, i.e., a sparse file whose elements are zero bytes.
+   * @details If @p preallocate is `true`, the disk blocks are reserved up front (`fallocate`) such that writing to the elements can't
+   *          fail because the disk is full (which would raise SIGBUS instead of an exception); ignored if not supported.
+   * @throws std::system_error if the file can't be created, resized, preallocated, or mapped
+   * @throws std::length_error if the file size would overflow
+   */
+  mapped_dynarray(const std::string& path, const size_type size, const bool preallocate = false)
+      : mapping_(path, file_size(size), preallocate), data_{ reinterpret_cast<pointer>(mapping_.data() + sizeof(detail::binary_header)) },
+        size_{ size } {
+    // the checksum of the zero bytes is written by the first flush()
+    const detail::binary_header header = detail::make_binary_header<T>(nullptr, 0);
+    std::memcpy(mapping_.data(), &header, sizeof(header));
+    this->header().count = size;
+  }
+  /**
+   * @brief Maps the existing file @p path written by cpp_util::write_binary (or a cpp_util::mapped_dynarray) for reading and writing.
+   * @throws std::system_error if the file can't be opened or mapped
+   * @throws std::runtime_error if the header doesn't match @p T, the file has the opposite byte order, or the file size doesn't match
+   */
+  explicit mapped_dynarray(const std::string& path, const map_prefetch prefetch = map_prefetch::none)
+      : mapping_(path, true, prefetch) {
+    const detail::binary_header header = detail::mapped_binary_header<T>(mapping_);
+    data_ = reinterpret_cast<pointer>(mapping_.data() + sizeof(header));
+    size_ = static_cast<size_type>(header.count);
+  }
+  mapped_dynarray(const mapped_dynarray&) = delete;
+  mapped_dynarray(mapped_dynarray&& other) noexcept
+      : mapping_(std::move(other.mapping_)), data_{ detail::exchange(other.data_, nullptr) }, size_{ detail::exchange(other.size_, size_type{ 0 }) } {}
+
+  /**************************************************************************************************************************************/
+  /**                                                            assignment                                                            **/
+  /**************************************************************************************************************************************/
+  mapped_dynarray& operator=(const mapped_dynarray&) = delete;
+  mapped_dynarray& operator=(mapped_dynarray&& other) noexcept {
+    mapped_dynarray tmp{ std::move(other) };
+    this->swap(tmp);
+    return *this;
+  }
+
+  /**************************************************************************************************************************************/
+  /**                                                          element access                                                          **/
+  /**************************************************************************************************************************************/
+  DYNARRAY_NODISCARD reference at(const size_type pos) {
+    if (pos >= size_) throw std::out_of_range{ "Index out-of-range: pos >= this->size()" };
+    return data_[pos];
+  }
+  DYNARRAY_NODISCARD const_reference at(const size_type pos) const {
+    if (pos >= size_) throw std::out_of_range{ "Index out-of-range: pos >= this->size()" };
+    return data_[pos];
+  }
+  DYNARRAY_NODISCARD reference operator[](const size_type pos) {
+    assert((pos < size_) && "Undefined behavior if pos >= this->size()!");
+    return data_[pos];
+  }
+  DYNARRAY_NODISCARD const_reference operator[](const size_type pos) const {
+    assert((pos < size_) && "Undefined behavior if pos >= this->size()!");
+    return data_[pos];
+  }
+  DYNARRAY_NODISCARD reference front() {
+    assert((!this->empty()) && "Calling front() is undefined for empty dynarrays!");
+    return data_[0];
+  }
+  DYNARRAY_NODISCARD const_reference front() const {
+    assert((!this->empty()) && "Calling front() is undefined for empty dynarrays!");
+    return data_[0];
+  }
+  DYNARRAY_NODISCARD reference back() {
+    assert((!this->empty()) && "Calling back() is undefined for empty dynarrays!");
+    return data_[size_ - 1];
+  }
+  DYNARRAY_NODISCARD const_reference back() const {
+    assert((!this->empty()) && "Calling back() is undefined for empty dynarrays!");
+    return data_[size_ - 1];
+  }
+  DYNARRAY_NODISCARD pointer data() noexcept { return data_; }
+  DYNARRAY_NODISCARD const_pointer data() const noexcept { return data_; }
+
+  /**************************************************************************************************************************************/
+  /**                                                         iterator support                                                         **/
+  /**************************************************************************************************************************************/
+  DYNARRAY_NODISCARD iterator begin() noexcept { return data_; }
+  DYNARRAY_NODISCARD const_iterator begin() const noexcept { return data_; }
+  DYNARRAY_NODISCARD iterator end() noexcept { return data_ + size_; }
+  DYNARRAY_NODISCARD const_iterator end() const noexcept { return data_ + size_; }
+  DYNARRAY_NODISCARD const_iterator cbegin() const noexcept { return data_; }
+  DYNARRAY_NODISCARD const_iterator cend() const noexcept { return data_ + size_; }
+  DYNARRAY_NODISCARD reverse_iterator rbegin() noexcept { return detail::make_reverse_iterator(this->end()); }
+  DYNARRAY_NODISCARD const_reverse_iterator rbegin() const noexcept { return detail::make_reverse_iterator(this->end()); }
+  DYNARRAY_NODISCARD reverse_iterator rend() noexcept { return detail::make_reverse_iterator(this->begin()); }
+  DYNARRAY_NODISCARD const_reverse_iterator rend() const noexcept { return detail::make_reverse_iterator(this->begin()); }
+  DYNARRAY_NODISCARD const_reverse_iterator crbegin() const noexcept { return detail::make_reverse_iterator(this->end()); }
+  DYNARRAY_NODISCARD const_reverse_iterator crend() const noexcept { return detail::make_reverse_iterator(this->begin()); }
+
+  /**************************************************************************************************************************************/
+  /**                                                             capacity                                                             **/
+  /**************************************************************************************************************************************/
+  DYNARRAY_NODISCARD bool empty() const noexcept { return size_ == 0; }
+  DYNARRAY_NODISCARD size_type size() const noexcept { return size_; }
+
+  /**************************************************************************************************************************************/
+  /**                                                            operations                                                            **/
+  /**************************************************************************************************************************************/
+  void swap(mapped_dynarray& other) noexcept {
+    mapping_.swap(other.mapping_);
+    std::swap(data_, other.data_);
+    std::swap(size_, other.size_);
+  }
+  void fill(const value_type& value = value_type{}) {
+    assert((data_ != nullptr) && "Calling fill() is undefined for nullptr data!");
+    std::fill(this->begin(), this->end(), value);
+  }
+  void iota(const value_type& value = value_type{}) {
+    assert((data_ != nullptr) && "Calling iota() is undefined for nullptr data!");
+    std::iota(this->begin(), this->end(), value);
+  }
+  template <typename Generator>
+  void generate(Generator gen) {
+    assert((data_ != nullptr) && "Calling generate() is undefined for nullptr data!");
+    std::generate(this->begin(), this->end(), gen);
+  }
+  void fill(const parallel_policy& policy, const value_type& value = value_type{}) {
+    assert((data_ != nullptr) && "Calling fill() is undefined for nullptr data!");
+    detail::parallel_for_chunks(data_, size_, policy.num_threads(), [&](const size_type first, const size_type last) {
+      std::fill(data_ + first, data_ + last, value);
+    });
+  }
+  // the start value of each chunk is computed directly as value + first
+  void iota(const parallel_policy& policy, const value_type& value = value_type{}) {
+    assert((data_ != nullptr) && "Calling iota() is undefined for nullptr data!");
+    detail::parallel_for_chunks(data_, size_, policy.num_threads(), [&](const size_type first, const size_type last) {
+      std::iota(data_ + first, data_ + last, static_cast<value_type>(value + static_cast<value_type>(first)));
+    });
+  }
+  // the generator is called as gen(pos) for each position (concurrently, i.e., it must be thread-safe)
+  template <typename Generator>
+  void generate(const parallel_policy& policy, Generator gen) {
+    assert((data_ != nullptr) && "Calling generate() is undefined for nullptr data!");
+    detail::parallel_for_chunks(data_, size_, policy.num_threads(), [&](const size_type first, const size_type last) {
+      for (size_type pos = first; pos < last; ++pos) {
+        data_[pos] = gen(pos);
+      }
+    });
+  }
+  /**
+   * @brief Writes the checksum of the elements into the header and synchronously writes all modified pages to disk (`msync(MS_SYNC)`),
+   *        i.e., afterwards the file can be read by cpp_util::read_binary or cpp_util::mapped_dynarray<const T>.
+   * @throws std::system_error if writing the pages fails
+   */
+  void flush() {
+    if (mapping_.data() == nullptr) {
+      return;
+    }
+    this->header().checksum = detail::xxh64::hash(data_, size_ * sizeof(T));
+    if (::msync(mapping_.data(), mapping_.size(), MS_SYNC) != 0) {
+      throw std::system_error{ errno, std::generic_category(), "Failed to write the memory mapped cpp_util::dynarray to disk" };
+    }
+  }
+  // tells the kernel how the elements will be accessed (only a hint, i.e., failures are ignored)
+  void advise(const map_advice advice) const noexcept {
+    if (mapping_.data() == nullptr) {
+      return;
+    }
+    int flag = MADV_NORMAL;
+    switch (advice) {
+      case map_advice::normal:
+        break;
+      case map_advice::sequential:
+        flag = MADV_SEQUENTIAL;
+        break;
+      case map_advice::random:
+        flag = MADV_RANDOM;
+        break;
+      case map_advice::will_need:
+        flag = MADV_WILLNEED;
+        break;
+      case map_advice::dont_need:
+        flag = MADV_DONTNEED;
+        break;
+    }
+    ::madvise(mapping_.data(), mapping_.size(), flag);
+  }
+
+  /**************************************************************************************************************************************/
+  /**                                                       non-member functions                                                       **/
+  /**************************************************************************************************************************************/
+#if defined(__cpp_impl_three_way_comparison) && defined(__cpp_lib_three_way_comparison)
+  DYNARRAY_NODISCARD friend bool operator==(const mapped_dynarray& lhs, const mapped_dynarray& rhs) noexcept {
+    return lhs.size() == rhs.size() && detail::equal_elements(lhs.data(), rhs.data(), lhs.size(), detail::is_bitwise_comparable<T>{});
+  }
+  DYNARRAY_NODISCARD friend std::strong_ordering operator<=>(const mapped_dynarray& lhs, const mapped_dynarray& rhs) noexcept {
+    return lhs.size() != rhs.size() ? lhs.size() <=> rhs.size()
+                                    : detail::lexicographical_compare_three_way(lhs.data(), lhs.size(), rhs.data(), rhs.size(),
+                                                                                detail::is_bitwise_comparable<T>{});
+  }
+#else
+  DYNARRAY_NODISCARD friend bool operator==(const mapped_dynarray& lhs, const mapped_dynarray& rhs) noexcept {
+    return lhs.size() == rhs.size() && detail::equal_elements(lhs.data(), rhs.data(), lhs.size(), detail::is_bitwise_comparable<T>{});
+  }
+  DYNARRAY_NODISCARD friend bool operator!=(const mapped_dynarray& lhs, const mapped_dynarray& rhs) noexcept { return !(lhs == rhs); }
+  DYNARRAY_NODISCARD friend bool operator<(const mapped_dynarray& lhs, const mapped_dynarray& rhs) noexcept {
+    return detail::lexicographical_less(lhs.data(), lhs.size(), rhs.data(), rhs.size(), detail::is_bitwise_comparable<T>{});
+  }
+  DYNARRAY_NODISCARD friend bool operator>(const mapped_dynarray& lhs, const mapped_dynarray& rhs) noexcept { return rhs < lhs; }
+  DYNARRAY_NODISCARD friend bool operator<=(const mapped_dynarray& lhs, const mapped_dynarray& rhs) noexcept { return !(rhs < lhs); }
+  DYNARRAY_NODISCARD friend bool operator>=(const mapped_dynarray& lhs, const mapped_dynarray& rhs) noexcept { return !(lhs < rhs); }
+#endif
+
+ private:
+  static std::size_t file_size(const size_type size) {
+    constexpr std::size_t max_off = static_cast<std::size_t>((std::numeric_limits< ::off_t>::max)());
+    if (size > (max_off - sizeof(detail::binary_header)) / sizeof(T)) {
+      throw std::length_error{ "The memory mapped cpp_util::dynarray would exceed the maximum file size" };
+    }
+    return sizeof(detail::binary_header) + size * sizeof(T);
+  }
+  DYNARRAY_NODISCARD detail::binary_header& header() noexcept { return *reinterpret_cast<detail::binary_header*>(mapping_.data()); }
+
+  detail::file_mapping mapping_;
+  pointer data_{ nullptr };
+  size_type size_{ 0 };
+};
+
+template <typename T>
+void swap(mapped_dynarray<T>& lhs, mapped_dynarray<T>& rhs) noexcept {
+  lhs.swap(rhs);
+}
+
+}  // namespace cpp_util
+
+#endif
+
+#endif  // CPP_UTIL_MAPPED_DYNARRAY_HPP
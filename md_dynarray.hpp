@@ -0,0 +1,512 @@
+/**
+ * Copyright (C) 2021 - Marcel Breyer - All Rights Reserved
+ * Licensed under the MIT License. See LICENSE.md file in the project root for full license information.
+ *
+ * Implements a multidimensional array with runtime fixed extents and row-major, column-major, or tiled memory layout.
+ */
+
+#ifndef CPP_UTIL_MD_DYNARRAY_HPP
+#define CPP_UTIL_MD_DYNARRAY_HPP
+
+#include "dynarray.hpp"
+
+#include <array>        // std::array
+#include <cassert>      // assert
+#include <cstddef>      // std::size_t, std::ptrdiff_t
+#include <memory>       // std::allocator
+#include <stdexcept>    // std::out_of_range
+#include <type_traits>  // std::enable_if, std::is_convertible, std::remove_cv, std::is_trivially_copyable, std::is_nothrow_move_assignable
+                        // std::true_type, std::false_type
+#include <utility>      // std::move
+
+#if __has_include(<mdspan>)
+#include <mdspan>  // std::mdspan, std::dextents, std::layout_stride
+#endif
+
+namespace cpp_util {
+
+namespace detail {
+
+// the L1 data cache size assumed by cpp_util::layout_tiled
+constexpr std::size_t l1_cache_size = 32 * 1024;
+
+constexpr std::size_t power(const std::size_t base, const std::size_t exp) { return exp == 0 ? 1 : base * power(base, exp - 1); }
+
+// the largest power of two t such that a tile of t^rank elements fills at most half of the L1 cache (leaving room for a second tile,
+// e.g., the destination of a transpose)
+constexpr std::size_t l1_tile_extent(const std::size_t rank, const std::size_t element_size, const std::size_t extent = 1) {
+  return power(2 * extent, rank) * element_size <= l1_cache_size / 2 ? l1_tile_extent(rank, element_size, 2 * extent) : extent;
+}
+
+// call func(idx) for all multidimensional indices idx within the extents in row-major order
+template <std::size_t Rank, typename Func>
+void for_each_index(const std::array<std::size_t, Rank>& extents, Func func) {
+  for (const std::size_t extent : extents) {
+    if (extent == 0) {
+      return;
+    }
+  }
+  std::array<std::size_t, Rank> idx{};
+  while (true) {
+    func(idx);
+    // increment the last index and carry over to the previous dimensions
+    std::size_t dim = Rank;
+    do {
+      --dim;
+      if (++idx[dim] < extents[dim]) {
+        break;
+      }
+      idx[dim] = 0;
+    } while (dim > 0);
+    if (dim == 0 && idx[0] == 0) {
+      return;
+    }
+  }
+}
+
+// the common part of the mappings of strided layouts: offset = sum(idx[d] * stride[d])
+template <std::size_t Rank>
+class strided_mapping {
+ public:
+  using extents_type = std::array<std::size_t, Rank>;
+
+  DYNARRAY_NODISCARD const extents_type& extents() const noexcept { return extents_; }
+  DYNARRAY_NODISCARD const extents_type& strides() const noexcept { return strides_; }
+  DYNARRAY_NODISCARD std::size_t stride(const std::size_t dim) const noexcept { return strides_[dim]; }
+  DYNARRAY_NODISCARD std::size_t required_span_size() const noexcept {
+    std::size_t size = 1;
+    for (const std::size_t extent : extents_) {
+      size *= extent;
+    }
+    return size;
+  }
+  DYNARRAY_NODISCARD std::size_t operator()(const extents_type& idx) const noexcept {
+    std::size_t offset = 0;
+    for (std::size_t dim = 0; dim < Rank; ++dim) {
+      offset += idx[dim] * strides_[dim];
+    }
+    return offset;
+  }
+  static constexpr bool is_strided() noexcept { return true; }
+
+ protected:
+  strided_mapping() = default;
+  explicit strided_mapping(const extents_type& extents) noexcept : extents_(extents) {}
+
+  extents_type extents_{};
+  extents_type strides_{};
+};
+
+}  // namespace detail
+
+/**
+ * @brief Row-major (C order) layout: the last index is contiguous in memory.
+ */
+struct layout_row_major {
+  template <typename T, std::size_t Rank>
+  class mapping : public detail::strided_mapping<Rank> {
+   public:
+    using extents_type = typename detail::strided_mapping<Rank>::extents_type;
+
+    mapping() = default;
+    explicit mapping(const extents_type& extents) noexcept : detail::strided_mapping<Rank>(extents) {
+      std::size_t stride = 1;
+      for (std::size_t dim = Rank; dim > 0; --dim) {
+        this->strides_[dim - 1] = stride;
+        stride *= extents[dim - 1];
+      }
+    }
+  };
+};
+
+/**
+ * @brief Column-major (Fortran order) layout: the first index is contiguous in memory.
+ */
+struct layout_column_major {
+  template <typename T, std::size_t Rank>
+  class mapping : public detail::strided_mapping<Rank> {
+   public:
+    using extents_type = typename detail::strided_mapping<Rank>::extents_type;
+
+    mapping() = default;
+    explicit mapping(const extents_type& extents) noexcept : detail::strided_mapping<Rank>(extents) {
+      std::size_t stride = 1;
+      for (std::size_t dim = 0; dim < Rank; ++dim) {
+        this->strides_[dim] = stride;
+        stride *= extents[dim];
+      }
+    }
+  };
+};
+
+/**
+ * @brief Tiled layout: the elements are stored in tiles of @p TileExtent elements per dimension, the tiles and the elements in a tile
+ *        in row-major order. Each extent is padded to a multiple of the tile extent. A @p TileExtent of 0 (the default) chooses the
+ *        largest power of two such that a tile fills at most half of the L1 cache, e.g., 64x64 floats. Neighboring elements in all
+ *        dimensions are close in memory, which reduces the cache misses of, e.g., transposes and stencils.
+ */
+template <std::size_t TileExtent = 0>
+struct layout_tiled {
+  static_assert((TileExtent & (TileExtent - 1)) == 0, "The tile extent must be a power of two (or 0)!");
+
+  template <typename T, std::size_t Rank>
+  class mapping {
+   public:
+    using extents_type = std::array<std::size_t, Rank>;
+
+    static constexpr std::size_t tile_extent() noexcept { return TileExtent != 0 ? TileExtent : detail::l1_tile_extent(Rank, sizeof(T)); }
+    static constexpr std::size_t tile_size() noexcept { return detail::power(tile_extent(), Rank); }
+
+    mapping() = default;
+    explicit mapping(const extents_type& extents) noexcept : extents_(extents) {
+      for (std::size_t dim = 0; dim < Rank; ++dim) {
+        num_tiles_[dim] = (extents[dim] + tile_extent() - 1) / tile_extent();
+      }
+    }
+
+    DYNARRAY_NODISCARD const extents_type& extents() const noexcept { return extents_; }
+    // including the padding of the last tile in each dimension
+    DYNARRAY_NODISCARD std::size_t required_span_size() const noexcept {
+      std::size_t size = tile_size();
+      for (const std::size_t num_tiles : num_tiles_) {
+        size *= num_tiles;
+      }
+      return size;
+    }
+    DYNARRAY_NODISCARD std::size_t operator()(const extents_type& idx) const noexcept {
+      // the tile extent is a compile-time power of two, i.e., the divisions and modulos are shifts and masks
+      std::size_t tile = 0;
+      std::size_t offset_in_tile = 0;
+      for (std::size_t dim = 0; dim < Rank; ++dim) {
+        tile = tile * num_tiles_[dim] + idx[dim] / tile_extent();
+        offset_in_tile = offset_in_tile * tile_extent() + idx[dim] % tile_extent();
+      }
+      return tile * tile_size() + offset_in_tile;
+    }
+    static constexpr bool is_strided() noexcept { return false; }
+
+   private:
+    extents_type extents_{};
+    extents_type num_tiles_{};
+  };
+};
+
+/**
+ * @brief A non-owning view of @p Rank dimensional elements with arbitrary strides, e.g., a slice of a cpp_util::md_dynarray.
+ *        The elements are modifiable unless @p T is const.
+ */
+template <typename T, std::size_t Rank>
+class strided_view {
+ public:
+  using element_type = T;
+  using value_type = typename std::remove_cv<T>::type;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = element_type&;
+  using pointer = element_type*;
+  using extents_type = std::array<size_type, Rank>;
+
+  strided_view() = default;
+  strided_view(pointer data, const extents_type& extents, const extents_type& strides) noexcept
+      : data_{ data }, extents_(extents), strides_(strides) {}
+  // a view of modifiable elements is implicitly convertible to a view of const elements
+  template <typename U, typename std::enable_if<std::is_convertible<U (*)[], T (*)[]>::value, bool>::type = true>
+  strided_view(const strided_view<U, Rank>& other) noexcept : data_{ other.data() }, extents_(other.extents()), strides_(other.strides()) {}
+
+  template <typename... Indices>
+  DYNARRAY_NODISCARD reference operator()(const Indices... idx) const {
+    static_assert(sizeof...(Indices) == Rank, "The number of indices must be equal to the rank!");
+    return (*this)(extents_type{ { static_cast<size_type>(idx)... } });
+  }
+  DYNARRAY_NODISCARD reference operator()(const extents_type& idx) const {
+    assert(this->in_bounds(idx) && "Undefined behavior if an index is out-of-range!");
+    size_type offset = 0;
+    for (size_type dim = 0; dim < Rank; ++dim) {
+      offset += idx[dim] * strides_[dim];
+    }
+    return data_[offset];
+  }
+  template <typename... Indices>
+  DYNARRAY_NODISCARD reference at(const Indices... idx) const {
+    static_assert(sizeof...(Indices) == Rank, "The number of indices must be equal to the rank!");
+    const extents_type index{ { static_cast<size_type>(idx)... } };
+    if (!this->in_bounds(index)) throw std::out_of_range{ "Index out-of-range: idx[d] >= this->extent(d)" };
+    return (*this)(index);
+  }
+  DYNARRAY_NODISCARD pointer data() const noexcept { return data_; }
+
+  static constexpr size_type rank() noexcept { return Rank; }
+  DYNARRAY_NODISCARD size_type extent(const size_type dim) const noexcept { return extents_[dim]; }
+  DYNARRAY_NODISCARD const extents_type& extents() const noexcept { return extents_; }
+  DYNARRAY_NODISCARD size_type stride(const size_type dim) const noexcept { return strides_[dim]; }
+  DYNARRAY_NODISCARD const extents_type& strides() const noexcept { return strides_; }
+  DYNARRAY_NODISCARD size_type size() const noexcept {
+    size_type size = 1;
+    for (const size_type extent : extents_) {
+      size *= extent;
+    }
+    return size;
+  }
+  DYNARRAY_NODISCARD bool empty() const noexcept { return this->size() == 0; }
+
+  // the view with dimension dim fixed to index, e.g., slice(0, i) is the i-th row of a matrix
+  template <std::size_t R = Rank, typename std::enable_if<(R > 1), bool>::type = true>
+  DYNARRAY_NODISCARD strided_view<T, Rank - 1> slice(const size_type dim, const size_type index) const {
+    assert((dim < Rank && index < extents_[dim]) && "Undefined behavior if dim >= this->rank() or index >= this->extent(dim)!");
+    std::array<size_type, Rank - 1> extents{};
+    std::array<size_type, Rank - 1> strides{};
+    for (size_type d = 0, sub = 0; d < Rank; ++d) {
+      if (d != dim) {
+        extents[sub] = extents_[d];
+        strides[sub] = strides_[d];
+        ++sub;
+      }
+    }
+    return strided_view<T, Rank - 1>{ data_ + index * strides_[dim], extents, strides };
+  }
+  // the view of the extents elements starting at first in each dimension
+  DYNARRAY_NODISCARD strided_view subview(const extents_type& first, const extents_type& extents) const {
+    size_type offset = 0;
+    for (size_type dim = 0; dim < Rank; ++dim) {
+      assert((first[dim] + extents[dim] <= extents_[dim]) && "Undefined behavior if the subview exceeds the view!");
+      offset += first[dim] * strides_[dim];
+    }
+    return strided_view{ data_ + offset, extents, strides_ };
+  }
+
+  void fill(const value_type& value = value_type{}) const {
+    detail::for_each_index(extents_, [&](const extents_type& idx) { (*this)(idx) = value; });
+  }
+
+#if defined(__cpp_lib_mdspan)
+  DYNARRAY_NODISCARD std::mdspan<element_type, std::dextents<size_type, Rank>, std::layout_stride> as_mdspan() const {
+    using mdspan_type = std::mdspan<element_type, std::dextents<size_type, Rank>, std::layout_stride>;
+    return mdspan_type{ data_, typename mdspan_type::mapping_type{ typename mdspan_type::extents_type{ extents_ }, strides_ } };
+  }
+#endif
+
+ private:
+  bool in_bounds(const extents_type& idx) const noexcept {
+    for (size_type dim = 0; dim < Rank; ++dim) {
+      if (idx[dim] >= extents_[dim]) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  pointer data_{ nullptr };
+  extents_type extents_{};
+  extents_type strides_{};
+};
+
+/**
+ * @brief A @p Rank dimensional array with runtime fixed extents owning a single cpp_util::dynarray buffer. The position of an element in
+ *        the buffer is given by the compile-time @p Layout: cpp_util::layout_row_major (default), cpp_util::layout_column_major, or
+ *        cpp_util::layout_tiled. Arrays with a strided (row- or column-major) layout can be sliced into cpp_util::strided_view%s.
+ */
+template <typename T, std::size_t Rank, typename Layout = layout_row_major, typename Allocator = std::allocator<T>>
+class md_dynarray {
+  static_assert(Rank > 0, "The rank must be at least 1!");
+
+ public:
+  /**************************************************************************************************************************************/
+  /**                                                              types                                                               **/
+  /**************************************************************************************************************************************/
+  using value_type = T;
+  using allocator_type = Allocator;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using pointer = value_type*;
+  using const_pointer = const value_type*;
+  using layout_type = Layout;
+  using mapping_type = typename layout_type::template mapping<value_type, Rank>;
+  using extents_type = std::array<size_type, Rank>;
+  using values_type = dynarray<value_type, allocator_type>;
+  using view_type = strided_view<value_type, Rank>;
+  using const_view_type = strided_view<const value_type, Rank>;
+
+  /**************************************************************************************************************************************/
+  /**                                                           construction                                                           **/
+  /**************************************************************************************************************************************/
+  md_dynarray() : md_dynarray(allocator_type()) {}
+  explicit md_dynarray(const allocator_type& alloc) : values_(alloc) {}
+  explicit md_dynarray(const extents_type& extents, const allocator_type& alloc = allocator_type())
+      : md_dynarray(extents, value_init, alloc) {}
+  md_dynarray(const extents_type& extents, value_init_t, const allocator_type& alloc = allocator_type())
+      : mapping_(extents), values_(mapping_.required_span_size(), value_init, alloc) {}
+  // the padding elements of a tiled layout are default-initialized, too
+  md_dynarray(const extents_type& extents, for_overwrite_t, const allocator_type& alloc = allocator_type())
+      : mapping_(extents), values_(mapping_.required_span_size(), for_overwrite, alloc) {}
+  md_dynarray(const extents_type& extents, const value_type& init, const allocator_type& alloc = allocator_type())
+      : mapping_(extents), values_(mapping_.required_span_size(), init, alloc) {}
+  // copy the elements of an array with a different layout, e.g., to convert a row-major image into tiles
+  template <typename OtherLayout>
+  explicit md_dynarray(const md_dynarray<value_type, Rank, OtherLayout, allocator_type>& other, const allocator_type& alloc = allocator_type())
+      : md_dynarray(other, alloc, std::is_trivially_copyable<value_type>{}) {}
+  md_dynarray(const md_dynarray&) = default;
+  // the moved-from md_dynarray has zero extents, i.e., it is empty
+  md_dynarray(md_dynarray&& other) noexcept
+      : mapping_{ detail::exchange(other.mapping_, mapping_type{}) }, values_{ std::move(other.values_) } {}
+
+  md_dynarray& operator=(const md_dynarray&) = default;
+  md_dynarray& operator=(md_dynarray&& other) noexcept(std::is_nothrow_move_assignable<values_type>::value) {
+    if (this != &other) {
+      values_ = std::move(other.values_);
+      mapping_ = detail::exchange(other.mapping_, mapping_type{});
+    }
+    return *this;
+  }
+
+  DYNARRAY_NODISCARD allocator_type get_allocator() const noexcept { return values_.get_allocator(); }
+
+  /**************************************************************************************************************************************/
+  /**                                                          element access                                                          **/
+  /**************************************************************************************************************************************/
+  template <typename... Indices>
+  DYNARRAY_NODISCARD reference operator()(const Indices... idx) {
+    static_assert(sizeof...(Indices) == Rank, "The number of indices must be equal to the rank!");
+    return (*this)(extents_type{ { static_cast<size_type>(idx)... } });
+  }
+  template <typename... Indices>
+  DYNARRAY_NODISCARD const_reference operator()(const Indices... idx) const {
+    static_assert(sizeof...(Indices) == Rank, "The number of indices must be equal to the rank!");
+    return (*this)(extents_type{ { static_cast<size_type>(idx)... } });
+  }
+  DYNARRAY_NODISCARD reference operator()(const extents_type& idx) {
+    assert(this->in_bounds(idx) && "Undefined behavior if an index is out-of-range!");
+    return values_[mapping_(idx)];
+  }
+  DYNARRAY_NODISCARD const_reference operator()(const extents_type& idx) const {
+    assert(this->in_bounds(idx) && "Undefined behavior if an index is out-of-range!");
+    return values_[mapping_(idx)];
+  }
+  template <typename... Indices>
+  DYNARRAY_NODISCARD reference at(const Indices... idx) {
+    static_assert(sizeof...(Indices) == Rank, "The number of indices must be equal to the rank!");
+    const extents_type index{ { static_cast<size_type>(idx)... } };
+    if (!this->in_bounds(index)) throw std::out_of_range{ "Index out-of-range: idx[d] >= this->extent(d)" };
+    return (*this)(index);
+  }
+  template <typename... Indices>
+  DYNARRAY_NODISCARD const_reference at(const Indices... idx) const {
+    static_assert(sizeof...(Indices) == Rank, "The number of indices must be equal to the rank!");
+    const extents_type index{ { static_cast<size_type>(idx)... } };
+    if (!this->in_bounds(index)) throw std::out_of_range{ "Index out-of-range: idx[d] >= this->extent(d)" };
+    return (*this)(index);
+  }
+  DYNARRAY_NODISCARD pointer data() noexcept { return values_.data(); }
+  DYNARRAY_NODISCARD const_pointer data() const noexcept { return values_.data(); }
+  // the underlying buffer (including the padding of tiled layouts)
+  DYNARRAY_NODISCARD values_type& values() noexcept { return values_; }
+  DYNARRAY_NODISCARD const values_type& values() const noexcept { return values_; }
+  DYNARRAY_NODISCARD const mapping_type& mapping() const noexcept { return mapping_; }
+
+  /**************************************************************************************************************************************/
+  /**                                                              views                                                               **/
+  /**************************************************************************************************************************************/
+  DYNARRAY_NODISCARD view_type view() noexcept {
+    static_assert(mapping_type::is_strided(), "Views are only available for strided layouts!");
+    return view_type{ values_.data(), mapping_.extents(), mapping_.strides() };
+  }
+  DYNARRAY_NODISCARD const_view_type view() const noexcept {
+    static_assert(mapping_type::is_strided(), "Views are only available for strided layouts!");
+    return const_view_type{ values_.data(), mapping_.extents(), mapping_.strides() };
+  }
+  template <std::size_t R = Rank, typename std::enable_if<(R > 1), bool>::type = true>
+  DYNARRAY_NODISCARD strided_view<value_type, Rank - 1> slice(const size_type dim, const size_type index) {
+    return this->view().slice(dim, index);
+  }
+  template <std::size_t R = Rank, typename std::enable_if<(R > 1), bool>::type = true>
+  DYNARRAY_NODISCARD strided_view<const value_type, Rank - 1> slice(const size_type dim, const size_type index) const {
+    return this->view().slice(dim, index);
+  }
+  DYNARRAY_NODISCARD view_type subview(const extents_type& first, const extents_type& extents) {
+    return this->view().subview(first, extents);
+  }
+  DYNARRAY_NODISCARD const_view_type subview(const extents_type& first, const extents_type& extents) const {
+    return this->view().subview(first, extents);
+  }
+#if defined(__cpp_lib_mdspan)
+  DYNARRAY_NODISCARD std::mdspan<value_type, std::dextents<size_type, Rank>, std::layout_stride> as_mdspan() {
+    return this->view().as_mdspan();
+  }
+  DYNARRAY_NODISCARD std::mdspan<const value_type, std::dextents<size_type, Rank>, std::layout_stride> as_mdspan() const {
+    return this->view().as_mdspan();
+  }
+#endif
+
+  /**************************************************************************************************************************************/
+  /**                                                             capacity                                                             **/
+  /**************************************************************************************************************************************/
+  static constexpr size_type rank() noexcept { return Rank; }
+  DYNARRAY_NODISCARD size_type extent(const size_type dim) const noexcept { return mapping_.extents()[dim]; }
+  DYNARRAY_NODISCARD const extents_type& extents() const noexcept { return mapping_.extents(); }
+  // the number of elements (excluding the padding of tiled layouts)
+  DYNARRAY_NODISCARD size_type size() const noexcept {
+    size_type size = 1;
+    for (const size_type extent : this->extents()) {
+      size *= extent;
+    }
+    return size;
+  }
+  DYNARRAY_NODISCARD bool empty() const noexcept { return this->size() == 0; }
+
+  /**************************************************************************************************************************************/
+  /**                                                            operations                                                            **/
+  /**************************************************************************************************************************************/
+  void swap(md_dynarray& other) noexcept {
+    using std::swap;
+    swap(mapping_, other.mapping_);
+    values_.swap(other.values_);
+  }
+  void fill(const value_type& value = value_type{}) { values_.fill(value); }
+  void fill(const parallel_policy& policy, const value_type& value = value_type{}) { values_.fill(policy, value); }
+
+  // the extents and all elements are equal (independent of the padding of tiled layouts)
+  DYNARRAY_NODISCARD friend bool operator==(const md_dynarray& lhs, const md_dynarray& rhs) {
+    if (lhs.extents() != rhs.extents()) {
+      return false;
+    }
+    bool equal = true;
+    detail::for_each_index(lhs.extents(), [&](const extents_type& idx) { equal = equal && lhs(idx) == rhs(idx); });
+    return equal;
+  }
+  DYNARRAY_NODISCARD friend bool operator!=(const md_dynarray& lhs, const md_dynarray& rhs) { return !(lhs == rhs); }
+
+ private:
+  bool in_bounds(const extents_type& idx) const noexcept {
+    for (size_type dim = 0; dim < Rank; ++dim) {
+      if (idx[dim] >= this->extent(dim)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // trivially copyable elements are overwritten anyway -> skip the value-initialization
+  template <typename OtherLayout>
+  md_dynarray(const md_dynarray<value_type, Rank, OtherLayout, allocator_type>& other, const allocator_type& alloc, std::true_type)
+      : mapping_(other.extents()), values_(mapping_.required_span_size(), for_overwrite, alloc) {
+    detail::for_each_index(this->extents(), [&](const extents_type& idx) { values_[mapping_(idx)] = other(idx); });
+  }
+  template <typename OtherLayout>
+  md_dynarray(const md_dynarray<value_type, Rank, OtherLayout, allocator_type>& other, const allocator_type& alloc, std::false_type)
+      : mapping_(other.extents()), values_(mapping_.required_span_size(), value_init, alloc) {
+    detail::for_each_index(this->extents(), [&](const extents_type& idx) { values_[mapping_(idx)] = other(idx); });
+  }
+
+  mapping_type mapping_;
+  values_type values_;
+};
+
+template <typename T, std::size_t Rank, typename Layout, typename Allocator>
+void swap(md_dynarray<T, Rank, Layout, Allocator>& lhs, md_dynarray<T, Rank, Layout, Allocator>& rhs) noexcept {
+  lhs.swap(rhs);
+}
+
+}  // namespace cpp_util
+
+#endif  // CPP_UTIL_MD_DYNARRAY_HPP
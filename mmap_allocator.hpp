@@ -0,0 +1,184 @@
+/**
+ * Copyright (C) 2021 - Marcel Breyer - All Rights Reserved
+ * Licensed under the MIT License. See LICENSE.md file in the project root for full license information.
+ *
+ * Implements an allocator backing large allocations with anonymous memory mappings, optionally using huge pages.
+ */
+
+#ifndef CPP_UTIL_MMAP_ALLOCATOR_HPP
+#define CPP_UTIL_MMAP_ALLOCATOR_HPP
+
+#include "dynarray.hpp"
+
+#include <cstddef>      // std::size_t, std::ptrdiff_t, std::max_align_t
+#include <cstdint>      // std::uintptr_t
+#include <cstdlib>      // std::malloc, std::calloc, std::free
+#include <limits>       // std::numeric_limits
+#include <new>          // std::bad_alloc
+#include <type_traits>  // std::true_type
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>  // mmap, munmap, madvise
+#define DYNARRAY_HAS_MMAP
+#endif
+
+namespace cpp_util {
+
+/**
+ * @brief The page backing used by cpp_util::mmap_allocator for allocations at or above its threshold.
+ */
+enum class page_backing {
+  /// anonymous mapping using the default page size
+  normal,
+  /// anonymous mapping aligned to the huge page size and marked with `madvise(MADV_HUGEPAGE)` (Linux transparent huge pages)
+  transparent_huge_pages,
+  /// anonymous mapping using `MAP_HUGETLB`; falls back to cpp_util::page_backing::transparent_huge_pages if no huge pages are reserved
+  explicit_huge_pages
+};
+
+/**
+ * @brief Allocator serving allocations of at least `threshold()` bytes with a private anonymous `mmap` using the requested
+ *        cpp_util::page_backing. Smaller allocations use `std::malloc`. Since fresh mappings are always zeroed, `allocate_zeroed(n)`
+ *        doesn't touch the memory, i.e., `cpp_util::dynarray<T, cpp_util::mmap_allocator<T>>(n, cpp_util::value_init)` is free.
+ *        On platforms without `mmap` all allocations use `std::malloc`.
+ */
+template <typename T>
+class mmap_allocator {
+ public:
+  using value_type = T;
+  // the allocation strategy depends on the state, hence, it must travel with the memory
+  using propagate_on_container_copy_assignment = std::true_type;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+
+  static_assert(alignof(T) <= alignof(std::max_align_t), "cpp_util::mmap_allocator doesn't support over-aligned types");
+
+  /// the size of a (PMD) huge page on x86-64 and AArch64 with 4 KiB base pages
+  static constexpr std::size_t huge_page_size = std::size_t{ 2 } << 20;
+  /// the default threshold: below a single huge page a mapping isn't worth the system call overhead
+  static constexpr std::size_t default_threshold = huge_page_size;
+
+  constexpr explicit mmap_allocator(const page_backing backing = page_backing::transparent_huge_pages,
+                                    const std::size_t threshold = default_threshold) noexcept
+      : backing_{ backing }, threshold_{ threshold } {}
+  template <typename U>
+  constexpr mmap_allocator(const mmap_allocator<U>& other) noexcept : backing_{ other.backing() }, threshold_{ other.threshold() } {}
+
+  DYNARRAY_NODISCARD T* allocate(const std::size_t n) {
+    if (n > max_size()) {
+      throw std::bad_alloc{};
+    }
+    return is_mapped(n) ? map(n) : check_allocation(std::malloc(n * sizeof(T)), n);
+  }
+  DYNARRAY_NODISCARD T* allocate_zeroed(const std::size_t n) {
+    if (n > max_size()) {
+      throw std::bad_alloc{};
+    }
+    return is_mapped(n) ? map(n) : check_allocation(std::calloc(n, sizeof(T)), n);
+  }
+  void deallocate(T* ptr, const std::size_t n) noexcept {
+    if (is_mapped(n)) {
+      unmap(ptr, n);
+    } else {
+      std::free(ptr);
+    }
+  }
+
+  DYNARRAY_NODISCARD static constexpr std::size_t max_size() noexcept {
+    return (static_cast<std::size_t>(std::numeric_limits<std::ptrdiff_t>::max()) - 2 * huge_page_size) / sizeof(T);
+  }
+  DYNARRAY_NODISCARD constexpr page_backing backing() const noexcept { return backing_; }
+  DYNARRAY_NODISCARD constexpr std::size_t threshold() const noexcept { return threshold_; }
+
+  // deallocate decides based on the state whether the memory was mapped
+  friend constexpr bool operator==(const mmap_allocator& lhs, const mmap_allocator& rhs) noexcept {
+    return lhs.backing_ == rhs.backing_ && lhs.threshold_ == rhs.threshold_;
+  }
+  friend constexpr bool operator!=(const mmap_allocator& lhs, const mmap_allocator& rhs) noexcept { return !(lhs == rhs); }
+
+ private:
+  constexpr bool is_mapped(const std::size_t n) const noexcept {
+#if defined(DYNARRAY_HAS_MMAP)
+    return n != 0 && n * sizeof(T) >= threshold_;
+#else
+    return static_cast<void>(n), false;
+#endif
+  }
+  constexpr std::size_t mapping_size(const std::size_t n) const noexcept {
+    // huge page backed mappings are always a whole number of huge pages
+    return backing_ == page_backing::normal ? n * sizeof(T) : (n * sizeof(T) + huge_page_size - 1) & ~(huge_page_size - 1);
+  }
+
+  static T* check_allocation(void* ptr, const std::size_t n) {
+    if (ptr == nullptr && n != 0) {
+      throw std::bad_alloc{};
+    }
+    return static_cast<T*>(ptr);
+  }
+
+#if defined(DYNARRAY_HAS_MMAP)
+  T* map(const std::size_t n) const {
+    const std::size_t size = mapping_size(n);
+#if defined(MAP_HUGETLB)
+    if (backing_ == page_backing::explicit_huge_pages) {
+      void* ptr = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+      if (ptr != MAP_FAILED) {
+        return static_cast<T*>(ptr);
+      }
+      // no (or not enough) huge pages reserved in /proc/sys/vm/nr_hugepages -> fall through to transparent huge pages
+    }
+#endif
+    if (backing_ == page_backing::normal) {
+      void* ptr = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+      if (ptr == MAP_FAILED) {
+        throw std::bad_alloc{};
+      }
+      return static_cast<T*>(ptr);
+    }
+
+    // over-map and trim the excess so that the kernel can back the whole range with huge pages
+    unsigned char* ptr = static_cast<unsigned char*>(
+        ::mmap(nullptr, size + huge_page_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+    if (static_cast<void*>(ptr) == MAP_FAILED) {
+      throw std::bad_alloc{};
+    }
+    const std::size_t head = (huge_page_size - reinterpret_cast<std::uintptr_t>(ptr) % huge_page_size) % huge_page_size;
+    if (head != 0) {
+      ::munmap(ptr, head);
+    }
+    ::munmap(ptr + head + size, huge_page_size - head);
+#if defined(MADV_HUGEPAGE)
+    // only a hint: fails if transparent huge pages are disabled, which leaves the mapping intact
+    ::madvise(ptr + head, size, MADV_HUGEPAGE);
+#endif
+    return reinterpret_cast<T*>(ptr + head);
+  }
+  void unmap(T* ptr, const std::size_t n) const noexcept { ::munmap(static_cast<void*>(ptr), mapping_size(n)); }
+#else
+  T* map(std::size_t) const { throw std::bad_alloc{}; }
+  void unmap(T*, std::size_t) const noexcept {}
+#endif
+
+  page_backing backing_;
+  std::size_t threshold_;
+};
+
+#if !defined(__cpp_inline_variables)
+template <typename T>
+constexpr std::size_t mmap_allocator<T>::huge_page_size;
+template <typename T>
+constexpr std::size_t mmap_allocator<T>::default_threshold;
+#endif
+
+/**
+ * @brief A cpp_util::dynarray whose memory is an anonymous mapping backed by (transparent) huge pages above a size threshold.
+ *        Pass a `cpp_util::mmap_allocator<T>(backing, threshold)` to the constructors to select the backing per instance.
+ */
+template <typename T>
+using huge_page_dynarray = dynarray<T, mmap_allocator<T>>;
+
+}  // namespace cpp_util
+
+#undef DYNARRAY_HAS_MMAP
+
+#endif  // CPP_UTIL_MMAP_ALLOCATOR_HPP
@@ -0,0 +1,485 @@
+/**
+ * Copyright (C) 2021 - Marcel Breyer - All Rights Reserved
+ * Licensed under the MIT License. See LICENSE.md file in the project root for full license information.
+ *
+ * Implements reading and writing cpp_util::dynarray and cpp_util::md_dynarray in the NumPy .npy format.
+ */
+
+#ifndef CPP_UTIL_NPY_IO_HPP
+#define CPP_UTIL_NPY_IO_HPP
+
+#include "binary_io.hpp"
+#include "dynarray.hpp"
+#include "md_dynarray.hpp"
+
+#include <algorithm>    // std::reverse, std::copy
+#include <cctype>       // std::isspace, std::isdigit
+#include <complex>      // std::complex
+#include <cstddef>      // std::size_t
+#include <cstdint>      // std::uint32_t, std::uintmax_t
+#include <cstring>      // std::memcmp
+#include <istream>      // std::istream
+#include <limits>       // std::numeric_limits
+#include <memory>       // std::allocator
+#include <ostream>      // std::ostream
+#include <stdexcept>    // std::runtime_error, std::length_error
+#include <string>       // std::string, std::to_string
+#include <type_traits>  // std::is_integral, std::is_floating_point, std::is_signed, std::is_same, std::true_type, std::false_type
+#include <vector>       // std::vector
+
+namespace cpp_util {
+
+namespace detail {
+
+DYNARRAY_INLINE_VARIABLE constexpr char npy_magic[6] = { '\x93', 'N', 'U', 'M', 'P', 'Y' };
+
+// the NumPy type kind of T (see `numpy.dtype.kind`), '\0' if T can't be stored in the .npy format
+template <typename T, typename = void>
+struct npy_dtype {
+  static constexpr char kind() noexcept { return '\0'; }
+  static constexpr std::size_t word_size() noexcept { return sizeof(T); }
+};
+template <>
+struct npy_dtype<bool> {
+  static constexpr char kind() noexcept { return 'b'; }
+  static constexpr std::size_t word_size() noexcept { return sizeof(bool); }
+};
+template <typename T>
+struct npy_dtype<T, typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value>::type> {
+  static constexpr char kind() noexcept { return std::is_signed<T>::value ? 'i' : 'u'; }
+  static constexpr std::size_t word_size() noexcept { return sizeof(T); }
+};
+template <typename T>
+struct npy_dtype<T, typename std::enable_if<std::is_floating_point<T>::value>::type> {
+  static constexpr char kind() noexcept { return 'f'; }
+  static constexpr std::size_t word_size() noexcept { return sizeof(T); }
+};
+// the real and imaginary parts are swapped separately
+template <typename T>
+struct npy_dtype<std::complex<T>, typename std::enable_if<std::is_floating_point<T>::value>::type> {
+  static constexpr char kind() noexcept { return 'c'; }
+  static constexpr std::size_t word_size() noexcept { return sizeof(T); }
+};
+
+// the .npy order of the md_dynarray layouts (tiled layouts can't be stored)
+template <typename Layout>
+struct npy_fortran_order;
+template <>
+struct npy_fortran_order<layout_row_major> : std::false_type {};
+template <>
+struct npy_fortran_order<layout_column_major> : std::true_type {};
+
+// the dtype of T in the native byte order, e.g., "<f4"
+template <typename T>
+std::string npy_descr() {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  const char byte_order = npy_dtype<T>::word_size() == 1 ? '|' : '>';
+#else
+  const char byte_order = npy_dtype<T>::word_size() == 1 ? '|' : '<';
+#endif
+  return std::string(1, byte_order) + npy_dtype<T>::kind() + std::to_string(sizeof(T));
+}
+
+/**
+ * @brief Checks that the dtype @p descr describes elements of type T (no conversions are performed).
+ * @return `true` if the elements are stored using the opposite byte order
+ * @throws std::runtime_error if @p descr describes a different type
+ */
+template <typename T>
+bool check_npy_descr(const std::string& descr) {
+  if (descr.empty() || descr.compare(1, std::string::npos, npy_descr<T>(), 1, std::string::npos) != 0) {
+    throw std::runtime_error{ "The .npy dtype '" + descr + "' doesn't match the element type '" + npy_descr<T>() + "'" };
+  }
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  const char opposite = '<';
+#else
+  const char opposite = '>';
+#endif
+  switch (descr[0]) {
+    case '<':
+    case '>':
+      return descr[0] == opposite && npy_dtype<T>::word_size() > 1;
+    case '|':
+    case '=':
+      return false;
+    default:
+      throw std::runtime_error{ "Invalid byte order of the .npy dtype '" + descr + "'" };
+  }
+}
+
+// reverses the bytes of all words of the @p count elements
+template <typename T>
+void npy_byteswap(T* data, const std::size_t count) noexcept {
+  unsigned char* bytes = reinterpret_cast<unsigned char*>(data);
+  constexpr std::size_t word_size = npy_dtype<T>::word_size();
+  for (std::size_t offset = 0; offset < count * sizeof(T); offset += word_size) {
+    std::reverse(bytes + offset, bytes + offset + word_size);
+  }
+}
+
+struct npy_header {
+  std::string descr;
+  bool fortran_order{ false };
+  std::vector<std::size_t> shape;
+};
+
+/**
+ * @brief Parses the Python dictionary literal of a .npy header, e.g., `{'descr': '<f8', 'fortran_order': False, 'shape': (3, 4), }`.
+ *        Structured dtypes (lists of fields) aren't supported.
+ */
+class npy_header_parser {
+ public:
+  explicit npy_header_parser(const std::string& dict) noexcept : dict_(dict) {}
+
+  DYNARRAY_NODISCARD npy_header parse() {
+    npy_header header{};
+    bool has_descr = false;
+    bool has_fortran_order = false;
+    bool has_shape = false;
+    this->expect('{');
+    while (!this->consume('}')) {
+      const std::string key = this->string();
+      this->expect(':');
+      if (key == "descr") {
+        header.descr = this->string();
+        has_descr = true;
+      } else if (key == "fortran_order") {
+        header.fortran_order = this->boolean();
+        has_fortran_order = true;
+      } else if (key == "shape") {
+        header.shape = this->tuple();
+        has_shape = true;
+      } else {
+        fail();
+      }
+      if (!this->consume(',')) {
+        this->expect('}');
+        break;
+      }
+    }
+    if (!has_descr || !has_fortran_order || !has_shape) {
+      fail();
+    }
+    return header;
+  }
+
+ private:
+  [[noreturn]] static void fail() { throw std::runtime_error{ "Invalid .npy header" }; }
+  void skip_whitespace() noexcept {
+    while (pos_ < dict_.size() && std::isspace(static_cast<unsigned char>(dict_[pos_]))) {
+      ++pos_;
+    }
+  }
+  bool consume(const char c) noexcept {
+    this->skip_whitespace();
+    if (pos_ < dict_.size() && dict_[pos_] == c) {
+      ++pos_;
+      return true;
+    }
+    return false;
+  }
+  void expect(const char c) {
+    if (!this->consume(c)) {
+      fail();
+    }
+  }
+  std::string string() {
+    this->skip_whitespace();
+    if (pos_ >= dict_.size() || (dict_[pos_] != '\'' && dict_[pos_] != '"')) {
+      fail();
+    }
+    const std::size_t last = dict_.find(dict_[pos_], pos_ + 1);
+    if (last == std::string::npos) {
+      fail();
+    }
+    std::string str = dict_.substr(pos_ + 1, last - pos_ - 1);
+    pos_ = last + 1;
+    return str;
+  }
+  bool boolean() {
+    this->skip_whitespace();
+    if (dict_.compare(pos_, 4, "True") == 0) {
+      pos_ += 4;
+      return true;
+    }
+    if (dict_.compare(pos_, 5, "False") == 0) {
+      pos_ += 5;
+      return false;
+    }
+    fail();
+  }
+  std::vector<std::size_t> tuple() {
+    std::vector<std::size_t> values;
+    this->expect('(');
+    while (!this->consume(')')) {
+      values.push_back(this->number());
+      if (!this->consume(',')) {
+        this->expect(')');
+        break;
+      }
+    }
+    return values;
+  }
+  std::size_t number() {
+    this->skip_whitespace();
+    if (pos_ >= dict_.size() || !std::isdigit(static_cast<unsigned char>(dict_[pos_]))) {
+      fail();
+    }
+    std::size_t value = 0;
+    for (; pos_ < dict_.size() && std::isdigit(static_cast<unsigned char>(dict_[pos_])); ++pos_) {
+      const std::size_t digit = static_cast<std::size_t>(dict_[pos_] - '0');
+      if (value > ((std::numeric_limits<std::size_t>::max)() - digit) / 10) {
+        throw std::length_error{ "The .npy shape exceeds the addressable size" };
+      }
+      value = value * 10 + digit;
+    }
+    return value;
+  }
+
+  const std::string& dict_;
+  std::size_t pos_{ 0 };
+};
+
+// reads and parses the magic string, version, and header using read(data, size)
+template <typename Read>
+npy_header read_npy_header(Read read) {
+  unsigned char preamble[8];
+  read(preamble, sizeof(preamble));
+  if (std::memcmp(preamble, npy_magic, sizeof(npy_magic)) != 0) {
+    throw std::runtime_error{ "Invalid .npy magic string" };
+  }
+  // version 1.0 stores the header length in 2 bytes, versions 2.0 and 3.0 (UTF-8 header) in 4 bytes (always little-endian)
+  std::size_t length_bytes = 0;
+  switch (preamble[6]) {
+    case 1:
+      length_bytes = 2;
+      break;
+    case 2:
+    case 3:
+      length_bytes = 4;
+      break;
+    default:
+      throw std::runtime_error{ "Unsupported .npy format version " + std::to_string(preamble[6]) };
+  }
+  unsigned char length_le[4] = {};
+  read(length_le, length_bytes);
+  std::size_t length = 0;
+  for (std::size_t i = length_bytes; i > 0; --i) {
+    length = (length << 8) | length_le[i - 1];
+  }
+  std::string dict(length, '\0');
+  read(&dict[0], length);
+  return npy_header_parser{ dict }.parse();
+}
+
+// the number of elements of the .npy shape
+inline std::size_t npy_count(const std::vector<std::size_t>& shape, const std::uintmax_t max_size) {
+  std::uintmax_t count = 1;
+  for (const std::size_t extent : shape) {
+    if (extent != 0 && count > max_size / extent) {
+      throw std::length_error{ "The number of elements of the .npy data exceeds max_size()" };
+    }
+    count *= extent;
+  }
+  return static_cast<std::size_t>(count);
+}
+
+// the header of @p rank dimensional data with the extents @p shape padded such that the data is aligned to 64 bytes
+template <typename T>
+std::string make_npy_header(const bool fortran_order, const std::size_t* shape, const std::size_t rank) {
+  std::string dict = "{'descr': '" + npy_descr<T>() + "', 'fortran_order': " + (fortran_order ? "True" : "False") + ", 'shape': (";
+  for (std::size_t dim = 0; dim < rank; ++dim) {
+    dict += (dim == 0 ? "" : ", ") + std::to_string(shape[dim]);
+  }
+  dict += rank == 1 ? ",), }" : "), }";
+
+  // the magic string, version, and header length take 10 bytes in version 1.0; version 2.0 (4 byte header length) only if necessary
+  std::size_t preamble = 10;
+  if ((preamble + dict.size() + 1 + 63) / 64 * 64 - preamble > 65535) {
+    preamble = 12;
+  }
+  dict.append((64 - (preamble + dict.size() + 1) % 64) % 64, ' ');
+  dict += '\n';
+
+  std::string header(npy_magic, sizeof(npy_magic));
+  header += static_cast<char>(preamble == 10 ? 1 : 2);
+  header += '\0';
+  for (std::size_t i = 0; i < preamble - 8; ++i) {
+    header += static_cast<char>((dict.size() >> (8 * i)) & 0xFF);
+  }
+  return header + dict;
+}
+
+template <typename T>
+void check_npy_element_type() {
+  static_assert(npy_dtype<T>::kind() != '\0', "Only arithmetic and std::complex elements can be stored in the .npy format");
+}
+
+template <typename T, typename Allocator, typename SizeType, typename Read>
+dynarray<T, Allocator, SizeType> read_npy(Read read, const Allocator& alloc) {
+  using array_type = dynarray<T, Allocator, SizeType>;
+  const npy_header header = read_npy_header(read);
+  const bool swapped = check_npy_descr<T>(header.descr);
+  if (header.shape.size() != 1) {
+    throw std::runtime_error{ "Only one-dimensional .npy data can be read into a cpp_util::dynarray" };
+  }
+  const std::size_t count = npy_count(header.shape, static_cast<std::uintmax_t>(array_type::max_size()));
+  // the elements are overwritten by the payload anyways
+  array_type arr(static_cast<SizeType>(count), for_overwrite, alloc);
+  read(arr.data(), count * sizeof(T));
+  if (swapped) {
+    npy_byteswap(arr.data(), count);
+  }
+  return arr;
+}
+
+template <typename T, std::size_t Rank, typename Layout, typename Allocator, typename Read>
+md_dynarray<T, Rank, Layout, Allocator> read_npy(Read read, const Allocator& alloc) {
+  using array_type = md_dynarray<T, Rank, Layout, Allocator>;
+  const npy_header header = read_npy_header(read);
+  const bool swapped = check_npy_descr<T>(header.descr);
+  if (header.shape.size() != Rank) {
+    throw std::runtime_error{ "The rank of the .npy data doesn't match the rank of the cpp_util::md_dynarray" };
+  }
+  // one-dimensional data is the same in both orders
+  if (Rank > 1 && header.fortran_order != npy_fortran_order<Layout>::value) {
+    throw std::runtime_error{ header.fortran_order ? "The .npy data is stored in Fortran order, use cpp_util::layout_column_major"
+                                                   : "The .npy data is stored in C order, use cpp_util::layout_row_major" };
+  }
+  const std::size_t count = npy_count(header.shape, static_cast<std::uintmax_t>(array_type::values_type::max_size()));
+  typename array_type::extents_type extents{};
+  std::copy(header.shape.begin(), header.shape.end(), extents.begin());
+  array_type arr(extents, for_overwrite, alloc);
+  read(arr.data(), count * sizeof(T));
+  if (swapped) {
+    npy_byteswap(arr.data(), count);
+  }
+  return arr;
+}
+
+}  // namespace detail
+
+/**
+ * @brief Writes @p arr as one-dimensional .npy data (in the native byte order) using a single bulk write for the elements.
+ * @throws std::runtime_error if writing fails
+ */
+template <typename T, typename Allocator, typename SizeType>
+void write_npy(std::ostream& out, const dynarray<T, Allocator, SizeType>& arr) {
+  detail::check_npy_element_type<T>();
+  const std::size_t shape[1] = { static_cast<std::size_t>(arr.size()) };
+  const std::string header = detail::make_npy_header<T>(false, shape, 1);
+  out.write(header.data(), static_cast<std::streamsize>(header.size()));
+  out.write(reinterpret_cast<const char*>(arr.data()), static_cast<std::streamsize>(arr.size() * sizeof(T)));
+  if (!out) {
+    throw std::runtime_error{ "Failed to write the .npy data" };
+  }
+}
+
+/**
+ * @brief Writes @p arr as .npy data in C order (cpp_util::layout_row_major) or Fortran order (cpp_util::layout_column_major).
+ * @throws std::runtime_error if writing fails
+ */
+template <typename T, std::size_t Rank, typename Layout, typename Allocator>
+void write_npy(std::ostream& out, const md_dynarray<T, Rank, Layout, Allocator>& arr) {
+  detail::check_npy_element_type<T>();
+  const std::string header = detail::make_npy_header<T>(detail::npy_fortran_order<Layout>::value, arr.extents().data(), Rank);
+  out.write(header.data(), static_cast<std::streamsize>(header.size()));
+  out.write(reinterpret_cast<const char*>(arr.data()), static_cast<std::streamsize>(arr.size() * sizeof(T)));
+  if (!out) {
+    throw std::runtime_error{ "Failed to write the .npy data" };
+  }
+}
+
+/**
+ * @brief Reads one-dimensional .npy data using a single allocation (without initializing the elements) and a single bulk read.
+ *        The dtype must match @p T exactly; elements stored in the opposite byte order are converted.
+ * @throws std::runtime_error if reading fails, the header is invalid, the dtype doesn't match, or the data isn't one-dimensional
+ * @throws std::length_error if the number of elements exceeds the max_size() of the cpp_util::dynarray
+ */
+template <typename T, typename Allocator = std::allocator<T>, typename SizeType = std::size_t>
+DYNARRAY_NODISCARD dynarray<T, Allocator, SizeType> read_npy(std::istream& in, const Allocator& alloc = Allocator()) {
+  detail::check_npy_element_type<T>();
+  return detail::read_npy<T, Allocator, SizeType>(
+      [&](void* data, const std::size_t size) {
+        if (!in.read(static_cast<char*>(data), static_cast<std::streamsize>(size))) {
+          throw std::runtime_error{ "Failed to read the .npy data" };
+        }
+      },
+      alloc);
+}
+
+/**
+ * @brief Reads @p Rank dimensional .npy data into a cpp_util::md_dynarray whose @p Layout matches the order of the data, i.e.,
+ *        cpp_util::layout_row_major for C order and cpp_util::layout_column_major for Fortran order, using a single allocation (without
+ *        initializing the elements) and a single bulk read.
+ * @throws std::runtime_error if reading fails, the header is invalid, the dtype, rank, or order doesn't match
+ * @throws std::length_error if the number of elements exceeds the max_size() of the underlying cpp_util::dynarray
+ */
+template <typename T, std::size_t Rank, typename Layout = layout_row_major, typename Allocator = std::allocator<T>>
+DYNARRAY_NODISCARD md_dynarray<T, Rank, Layout, Allocator> read_npy(std::istream& in, const Allocator& alloc = Allocator()) {
+  detail::check_npy_element_type<T>();
+  return detail::read_npy<T, Rank, Layout, Allocator>(
+      [&](void* data, const std::size_t size) {
+        if (!in.read(static_cast<char*>(data), static_cast<std::streamsize>(size))) {
+          throw std::runtime_error{ "Failed to read the .npy data" };
+        }
+      },
+      alloc);
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+/**
+ * @brief Writes @p arr as one-dimensional .npy data to the file descriptor @p fd bypassing the stream buffers.
+ * @throws std::system_error if writing fails
+ */
+template <typename T, typename Allocator, typename SizeType>
+void write_npy(const int fd, const dynarray<T, Allocator, SizeType>& arr) {
+  detail::check_npy_element_type<T>();
+  const std::size_t shape[1] = { static_cast<std::size_t>(arr.size()) };
+  const std::string header = detail::make_npy_header<T>(false, shape, 1);
+  detail::write_all(fd, header.data(), header.size());
+  detail::write_all(fd, arr.data(), arr.size() * sizeof(T));
+}
+
+/**
+ * @brief Writes @p arr as .npy data to the file descriptor @p fd bypassing the stream buffers.
+ * @throws std::system_error if writing fails
+ */
+template <typename T, std::size_t Rank, typename Layout, typename Allocator>
+void write_npy(const int fd, const md_dynarray<T, Rank, Layout, Allocator>& arr) {
+  detail::check_npy_element_type<T>();
+  const std::string header = detail::make_npy_header<T>(detail::npy_fortran_order<Layout>::value, arr.extents().data(), Rank);
+  detail::write_all(fd, header.data(), header.size());
+  detail::write_all(fd, arr.data(), arr.size() * sizeof(T));
+}
+
+/**
+ * @brief Reads one-dimensional .npy data from the file descriptor @p fd bypassing the stream buffers.
+ * @throws std::system_error if reading fails
+ * @throws std::runtime_error if the data ends prematurely, the header is invalid, the dtype doesn't match, or the data isn't
+ *         one-dimensional
+ * @throws std::length_error if the number of elements exceeds the max_size() of the cpp_util::dynarray
+ */
+template <typename T, typename Allocator = std::allocator<T>, typename SizeType = std::size_t>
+DYNARRAY_NODISCARD dynarray<T, Allocator, SizeType> read_npy(const int fd, const Allocator& alloc = Allocator()) {
+  detail::check_npy_element_type<T>();
+  return detail::read_npy<T, Allocator, SizeType>([fd](void* data, const std::size_t size) { detail::read_all(fd, data, size); }, alloc);
+}
+
+/**
+ * @brief Reads @p Rank dimensional .npy data from the file descriptor @p fd bypassing the stream buffers.
+ * @throws std::system_error if reading fails
+ * @throws std::runtime_error if the data ends prematurely, the header is invalid, the dtype, rank, or order doesn't match
+ * @throws std::length_error if the number of elements exceeds the max_size() of the underlying cpp_util::dynarray
+ */
+template <typename T, std::size_t Rank, typename Layout = layout_row_major, typename Allocator = std::allocator<T>>
+DYNARRAY_NODISCARD md_dynarray<T, Rank, Layout, Allocator> read_npy(const int fd, const Allocator& alloc = Allocator()) {
+  detail::check_npy_element_type<T>();
+  return detail::read_npy<T, Rank, Layout, Allocator>([fd](void* data, const std::size_t size) { detail::read_all(fd, data, size); },
+                                                      alloc);
+}
+#endif
+
+}  // namespace cpp_util
+
+#endif  // CPP_UTIL_NPY_IO_HPP
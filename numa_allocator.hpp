@@ -0,0 +1,170 @@
+/**
+ * Copyright (C) 2021 - Marcel Breyer - All Rights Reserved
+ * Licensed under the MIT License. See LICENSE.md file in the project root for full license information.
+ *
+ * Implements an allocator placing large allocations on NUMA nodes using the Linux mbind system call.
+ */
+
+#ifndef CPP_UTIL_NUMA_ALLOCATOR_HPP
+#define CPP_UTIL_NUMA_ALLOCATOR_HPP
+
+#include "dynarray.hpp"
+#include "mmap_allocator.hpp"
+
+#include <climits>      // CHAR_BIT
+#include <cstddef>      // std::size_t
+#include <stdexcept>    // std::invalid_argument
+#include <type_traits>  // std::true_type
+
+// the system calls are used directly, i.e., libnuma isn't required
+#if defined(__linux__) && __has_include(<sys/syscall.h>)
+#include <sys/syscall.h>  // SYS_mbind, SYS_get_mempolicy
+#include <unistd.h>       // syscall
+#if defined(SYS_mbind) && defined(SYS_get_mempolicy)
+#define DYNARRAY_HAS_NUMA
+#endif
+#endif
+
+namespace cpp_util {
+
+namespace detail {
+
+// the memory policy constants of <linux/mempolicy.h> (not included to avoid clashing with <numaif.h>)
+constexpr int mpol_bind = 2;
+constexpr int mpol_interleave = 3;
+constexpr unsigned long mpol_f_node = 1;
+constexpr unsigned long mpol_f_addr = 2;
+constexpr unsigned long mpol_f_mems_allowed = 4;
+// the kernel ignores the last bit of the node mask (maxnode - 1 bits are used)
+constexpr unsigned long mpol_max_node = sizeof(unsigned long) * CHAR_BIT + 1;
+
+}  // namespace detail
+
+/**
+ * @brief Returns the mask of NUMA nodes the calling thread may allocate memory on (bit i set means node i is allowed).
+ *        Returns `1` (only node 0) if NUMA isn't supported.
+ */
+inline unsigned long numa_allowed_nodes() noexcept {
+#if defined(DYNARRAY_HAS_NUMA)
+  unsigned long nodes = 0;
+  if (::syscall(SYS_get_mempolicy, nullptr, &nodes, detail::mpol_max_node, nullptr, detail::mpol_f_mems_allowed) == 0 && nodes != 0) {
+    return nodes;
+  }
+#endif
+  return 1;
+}
+
+/**
+ * @brief Returns the NUMA node the page containing @p ptr resides on or `-1` if it can't be determined (e.g., the page wasn't touched yet).
+ */
+inline int numa_node_of(const void* ptr) noexcept {
+#if defined(DYNARRAY_HAS_NUMA)
+  int node = -1;
+  if (::syscall(SYS_get_mempolicy, &node, nullptr, 0ul, ptr, detail::mpol_f_node | detail::mpol_f_addr) == 0) {
+    return node;
+  }
+#else
+  static_cast<void>(ptr);
+#endif
+  return -1;
+}
+
+/**
+ * @brief The NUMA placement of the pages allocated by cpp_util::numa_allocator.
+ */
+enum class numa_placement {
+  /// each page is placed on the node of the thread touching it first, i.e., initialize the elements using the parallel overloads
+  first_touch,
+  /// the pages are interleaved round-robin over all allowed nodes
+  interleave,
+  /// all pages are placed on a single node
+  bind
+};
+
+/**
+ * @brief Allocator placing all allocations served by an anonymous mapping of the upstream cpp_util::mmap_allocator (i.e., of at least
+ *        `upstream().threshold()` bytes) according to the requested cpp_util::numa_placement using `mbind`.
+ *        The placement is a best effort: if NUMA isn't supported (or `mbind` fails) the memory is allocated without a policy.
+ *
+ *        For cpp_util::numa_placement::first_touch the memory must be initialized by the worker threads that later process it,
+ *        e.g., `dynarray<T, numa_allocator<T>> arr(n, cpp_util::for_overwrite); arr.fill(cpp_util::par, value);`: the mapping is
+ *        neither touched by cpp_util::for_overwrite (for trivial types) nor by cpp_util::value_init and the parallel overloads
+ *        always use the same chunks for the same size and number of threads.
+ *        The default upstream uses cpp_util::page_backing::normal since the chunk boundaries are only aligned to cache lines: with
+ *        huge pages, a whole 2 MiB page is placed on the node of the thread touching it first, i.e., per huge page and not per chunk.
+ */
+template <typename T>
+class numa_allocator {
+ public:
+  using value_type = T;
+  using propagate_on_container_copy_assignment = std::true_type;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+
+  template <typename U>
+  struct rebind {
+    using other = numa_allocator<U>;
+  };
+
+  /**
+   * @brief Construct an allocator using the @p placement. @p node is only used by cpp_util::numa_placement::bind.
+   * @throws std::invalid_argument if @p placement is cpp_util::numa_placement::bind and @p node can't be represented in a node mask
+   */
+  explicit numa_allocator(const numa_placement placement = numa_placement::first_touch, const int node = 0,
+                          const mmap_allocator<T>& upstream = mmap_allocator<T>{ page_backing::normal })
+      : placement_{ placement }, node_{ node }, upstream_{ upstream } {
+    if (placement_ == numa_placement::bind && (node_ < 0 || node_ >= static_cast<int>(detail::mpol_max_node - 1))) {
+      throw std::invalid_argument{ "Invalid NUMA node!" };
+    }
+  }
+  template <typename U>
+  numa_allocator(const numa_allocator<U>& other) noexcept
+      : placement_{ other.placement() }, node_{ other.node() }, upstream_{ other.upstream() } {}
+
+  DYNARRAY_NODISCARD T* allocate(const std::size_t n) { return place(upstream_.allocate(n), n); }
+  DYNARRAY_NODISCARD T* allocate_zeroed(const std::size_t n) { return place(upstream_.allocate_zeroed(n), n); }
+  void deallocate(T* ptr, const std::size_t n) noexcept { upstream_.deallocate(ptr, n); }
+
+  DYNARRAY_NODISCARD static constexpr std::size_t max_size() noexcept { return mmap_allocator<T>::max_size(); }
+  DYNARRAY_NODISCARD numa_placement placement() const noexcept { return placement_; }
+  DYNARRAY_NODISCARD int node() const noexcept { return node_; }
+  DYNARRAY_NODISCARD const mmap_allocator<T>& upstream() const noexcept { return upstream_; }
+
+  friend bool operator==(const numa_allocator& lhs, const numa_allocator& rhs) noexcept {
+    return lhs.placement_ == rhs.placement_ && lhs.node_ == rhs.node_ && lhs.upstream_ == rhs.upstream_;
+  }
+  friend bool operator!=(const numa_allocator& lhs, const numa_allocator& rhs) noexcept { return !(lhs == rhs); }
+
+ private:
+  T* place(T* ptr, const std::size_t n) const noexcept {
+#if defined(DYNARRAY_HAS_NUMA)
+    // memory obtained from std::malloc isn't page aligned and may be shared with other allocations
+    if (placement_ == numa_placement::first_touch || n == 0 || n * sizeof(T) < upstream_.threshold()) {
+      return ptr;
+    }
+    const int mode = placement_ == numa_placement::interleave ? detail::mpol_interleave : detail::mpol_bind;
+    const unsigned long nodes = placement_ == numa_placement::interleave ? numa_allowed_nodes() : 1ul << node_;
+    // the pages weren't touched yet, hence, nothing must be migrated
+    ::syscall(SYS_mbind, static_cast<void*>(ptr), n * sizeof(T), mode, &nodes, detail::mpol_max_node, 0u);
+#else
+    static_cast<void>(n);
+#endif
+    return ptr;
+  }
+
+  numa_placement placement_;
+  int node_;
+  mmap_allocator<T> upstream_;
+};
+
+/**
+ * @brief A cpp_util::dynarray whose memory is placed on the NUMA nodes according to its cpp_util::numa_allocator.
+ */
+template <typename T>
+using numa_dynarray = dynarray<T, numa_allocator<T>>;
+
+}  // namespace cpp_util
+
+#undef DYNARRAY_HAS_NUMA
+
+#endif  // CPP_UTIL_NUMA_ALLOCATOR_HPP
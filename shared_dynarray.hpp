@@ -0,0 +1,522 @@
+/**
+ * Copyright (C) 2021 - Marcel Breyer - All Rights Reserved
+ * Licensed under the MIT License. See LICENSE.md file in the project root for full license information.
+ *
+ * Implements a cpp_util::dynarray in POSIX shared memory which other processes on the same machine can attach to without copying.
+ */
+
+#ifndef CPP_UTIL_SHARED_DYNARRAY_HPP
+#define CPP_UTIL_SHARED_DYNARRAY_HPP
+
+#include "mapped_dynarray.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#include <algorithm>     // std::fill, std::generate
+#include <cassert>       // assert
+#include <cerrno>        // errno
+#include <cstddef>       // std::size_t, std::ptrdiff_t
+#include <cstring>       // std::memcpy
+#include <iterator>      // std::reverse_iterator
+#include <limits>        // std::numeric_limits
+#include <numeric>       // std::iota
+#include <stdexcept>     // std::out_of_range, std::runtime_error, std::length_error
+#include <string>        // std::string
+#include <system_error>  // std::system_error, std::generic_category
+#include <type_traits>   // std::is_trivially_copyable
+#include <utility>       // std::move, std::swap
+
+#if __has_include(<compare>)
+#include <compare>  // std::strong_ordering
+#endif
+
+#include <fcntl.h>     // ::fcntl, O_RDONLY, O_RDWR, O_CREAT, O_EXCL, O_CLOEXEC, F_ADD_SEALS, F_SEAL_SHRINK, F_SEAL_GROW
+#include <sys/mman.h>  // ::shm_open, ::shm_unlink, ::memfd_create
+#include <sys/stat.h>  // ::fstat
+#include <unistd.h>    // ::close, ::ftruncate
+
+namespace cpp_util {
+
+namespace detail {
+
+// the size of a shared memory object holding the header and @p size elements of type T
+template <typename T>
+std::size_t shared_memory_size(const std::size_t size) {
+  constexpr std::size_t max_off = static_cast<std::size_t>((std::numeric_limits< ::off_t>::max)());
+  if (size > (max_off - sizeof(binary_header)) / sizeof(T)) {
+    throw std::length_error{ "The shared cpp_util::dynarray would exceed the maximum shared memory size" };
+  }
+  return sizeof(binary_header) + size * sizeof(T);
+}
+
+// resizes the new shared memory object @p fd and maps it for writing; closes @p fd on failure
+inline file_mapping create_shared_memory(const int fd, const std::size_t size) {
+  if (::ftruncate(fd, static_cast< ::off_t>(size)) != 0) {
+    const int error = errno;
+    ::close(fd);
+    throw std::system_error{ error, std::generic_category(), "Failed to resize the shared memory" };
+  }
+  try {
+    return file_mapping{ fd, size, true };
+  } catch (...) {
+    ::close(fd);
+    throw;
+  }
+}
+
+// maps the existing shared memory object @p fd holding elements of type T and validates its header
+template <typename T>
+file_mapping attach_shared_memory(const int fd, const bool writable) {
+  struct ::stat status {};
+  if (::fstat(fd, &status) != 0) {
+    throw std::system_error{ errno, std::generic_category(), "Failed to query the size of the shared memory" };
+  }
+  if (static_cast<std::size_t>(status.st_size) < sizeof(binary_header)) {
+    throw std::runtime_error{ "Invalid cpp_util::dynarray binary header" };
+  }
+  file_mapping mapping{ fd, static_cast<std::size_t>(status.st_size), writable };
+  binary_header header{};
+  std::memcpy(&header, mapping.data(), sizeof(header));
+  // the size of a shared memory object may be rounded up to whole pages
+  if (check_binary_header<T>(header) || header.count > (mapping.size() - sizeof(header)) / sizeof(T)) {
+    throw std::runtime_error{ "The shared memory doesn't hold the number of elements of the cpp_util::dynarray binary header" };
+  }
+  return mapping;
+}
+
+// the number of elements recorded in the (already validated) header at the start of @p mapping
+inline std::size_t shared_memory_count(const file_mapping& mapping) noexcept {
+  binary_header header{};
+  std::memcpy(&header, mapping.data(), sizeof(header));
+  return static_cast<std::size_t>(header.count);
+}
+
+// maps the shared memory object @p name holding elements of type T and validates its header
+template <typename T>
+file_mapping attach_shared_memory(const std::string& name, const bool writable) {
+  const int fd = ::shm_open(name.c_str(), (writable ? O_RDWR : O_RDONLY) | O_CLOEXEC, 0);
+  if (fd < 0) {
+    throw std::system_error{ errno, std::generic_category(), "Failed to open the shared memory " + name };
+  }
+  try {
+    file_mapping mapping = attach_shared_memory<T>(fd, writable);
+    ::close(fd);
+    return mapping;
+  } catch (...) {
+    ::close(fd);
+    throw;
+  }
+}
+
+}  // namespace detail
+
+/**
+ * @brief A cpp_util::dynarray in a POSIX shared memory object preceded by the header of the cpp_util::write_binary format (recording the
+ *        element size and count), i.e., other processes on the same machine can attach to it by name or file descriptor and access the
+ *        elements without copying. Attaching checks the element size and count against the header. The elements of a new shared
+ *        memory object are zero bytes. The accesses of different processes aren't synchronized, e.g., the creator should fill the
+ *        elements before handing the name or file descriptor to the readers.
+ */
+template <typename T>
+class shared_dynarray {
+ public:
+  /**************************************************************************************************************************************/
+  /**                                                              types                                                               **/
+  /**************************************************************************************************************************************/
+  using value_type = T;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using pointer = value_type*;
+  using const_pointer = const value_type*;
+  using iterator = pointer;
+  using const_iterator = const_pointer;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable elements can be shared between processes");
+  static_assert(alignof(T) <= sizeof(detail::binary_header), "The elements in the shared memory are only aligned to 64 bytes");
+
+  /**************************************************************************************************************************************/
+  /**                                                           construction                                                           **/
+  /**************************************************************************************************************************************/
+  shared_dynarray() noexcept = default;
+  /**
+   * @brief Creates the named shared memory object @p name (e.g., "/features", see `shm_open`) with @p size elements. The name is removed
+   *        when the returned shared_dynarray is destroyed, while already attached processes keep their mappings.
+   * @throws std::system_error if the shared memory object already exists or can't be created, resized, or mapped
+   * @throws std::length_error if the size would overflow
+   */
+  DYNARRAY_NODISCARD static shared_dynarray create(const std::string& name, const size_type size) {
+    const std::size_t bytes = detail::shared_memory_size<T>(size);
+    const int fd = ::shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, 0600);
+    if (fd < 0) {
+      throw std::system_error{ errno, std::generic_category(), "Failed to create the shared memory " + name };
+    }
+    try {
+      shared_dynarray arr{ detail::create_shared_memory(fd, bytes), size };
+      ::close(fd);
+      arr.name_ = name;
+      return arr;
+    } catch (...) {
+      ::shm_unlink(name.c_str());
+      throw;
+    }
+  }
+#if defined(MFD_CLOEXEC)
+  /**
+   * @brief Creates an anonymous shared memory object (`memfd_create`) with @p size elements. Other processes attach to it using the file
+   *        descriptor fd(), e.g., inherited by `fork` or passed over a UNIX domain socket. The size of the shared memory object is
+   *        sealed, i.e., no process can shrink it underneath the attached mappings.
+   * @throws std::system_error if the shared memory object can't be created, resized, mapped, or sealed
+   * @throws std::length_error if the size would overflow
+   */
+  DYNARRAY_NODISCARD static shared_dynarray create(const size_type size) {
+    const std::size_t bytes = detail::shared_memory_size<T>(size);
+    const int fd = ::memfd_create("cpp_util::shared_dynarray", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+    if (fd < 0) {
+      throw std::system_error{ errno, std::generic_category(), "Failed to create the shared memory" };
+    }
+    shared_dynarray arr{ detail::create_shared_memory(fd, bytes), size };
+    arr.fd_ = fd;
+    // arr owns the file descriptor -> it is closed and unmapped if sealing fails
+    if (::fcntl(fd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_SEAL) != 0) {
+      throw std::system_error{ errno, std::generic_category(), "Failed to seal the size of the shared memory" };
+    }
+    return arr;
+  }
+#endif
+  /**
+   * @brief Attaches to the named shared memory object @p name created by another shared_dynarray for reading and writing.
+   * @throws std::system_error if the shared memory object can't be opened or mapped
+   * @throws std::runtime_error if the header doesn't match @p T or the shared memory is too small for the number of elements
+   */
+  DYNARRAY_NODISCARD static shared_dynarray attach(const std::string& name) {
+    return shared_dynarray{ detail::attach_shared_memory<T>(name, true) };
+  }
+  /**
+   * @brief Attaches to the shared memory object @p fd created by another shared_dynarray for reading and writing. The caller keeps the
+   *        ownership of @p fd, i.e., it may be closed directly afterwards.
+   * @throws std::system_error if the shared memory object can't be mapped
+   * @throws std::runtime_error if the header doesn't match @p T or the shared memory is too small for the number of elements
+   */
+  DYNARRAY_NODISCARD static shared_dynarray attach(const int fd) { return shared_dynarray{ detail::attach_shared_memory<T>(fd, true) }; }
+  shared_dynarray(const shared_dynarray&) = delete;
+  shared_dynarray(shared_dynarray&& other) noexcept
+      : mapping_(std::move(other.mapping_)),
+        data_{ detail::exchange(other.data_, nullptr) },
+        size_{ detail::exchange(other.size_, size_type{ 0 }) },
+        fd_{ detail::exchange(other.fd_, -1) },
+        name_(std::move(other.name_)) {
+    other.name_.clear();
+  }
+
+  /**************************************************************************************************************************************/
+  /**                                                           destruction                                                            **/
+  /**************************************************************************************************************************************/
+  ~shared_dynarray() {
+    if (!name_.empty()) {
+      ::shm_unlink(name_.c_str());
+    }
+    if (fd_ >= 0) {
+      ::close(fd_);
+    }
+  }
+
+  /**************************************************************************************************************************************/
+  /**                                                            assignment                                                            **/
+  /**************************************************************************************************************************************/
+  shared_dynarray& operator=(const shared_dynarray&) = delete;
+  shared_dynarray& operator=(shared_dynarray&& other) noexcept {
+    shared_dynarray tmp{ std::move(other) };
+    this->swap(tmp);
+    return *this;
+  }
+
+  /**************************************************************************************************************************************/
+  /**                                                          element access                                                          **/
+  /**************************************************************************************************************************************/
+  DYNARRAY_NODISCARD reference at(const size_type pos) {
+    if (pos >= size_) throw std::out_of_range{ "Index out-of-range: pos >= this->size()" };
+    return data_[pos];
+  }
+  DYNARRAY_NODISCARD const_reference at(const size_type pos) const {
+    if (pos >= size_) throw std::out_of_range{ "Index out-of-range: pos >= this->size()" };
+    return data_[pos];
+  }
+  DYNARRAY_NODISCARD reference operator[](const size_type pos) {
+    assert((pos < size_) && "Undefined behavior if pos >= this->size()!");
+    return data_[pos];
+  }
+  DYNARRAY_NODISCARD const_reference operator[](const size_type pos) const {
+    assert((pos < size_) && "Undefined behavior if pos >= this->size()!");
+    return data_[pos];
+  }
+  DYNARRAY_NODISCARD reference front() {
+    assert((!this->empty()) && "Calling front() is undefined for empty dynarrays!");
+    return data_[0];
+  }
+  DYNARRAY_NODISCARD const_reference front() const {
+    assert((!this->empty()) && "Calling front() is undefined for empty dynarrays!");
+    return data_[0];
+  }
+  DYNARRAY_NODISCARD reference back() {
+    assert((!this->empty()) && "Calling back() is undefined for empty dynarrays!");
+    return data_[size_ - 1];
+  }
+  DYNARRAY_NODISCARD const_reference back() const {
+    assert((!this->empty()) && "Calling back() is undefined for empty dynarrays!");
+    return data_[size_ - 1];
+  }
+  DYNARRAY_NODISCARD pointer data() noexcept { return data_; }
+  DYNARRAY_NODISCARD const_pointer data() const noexcept { return data_; }
+
+  /**************************************************************************************************************************************/
+  /**                                                         iterator support                                                         **/
+  /**************************************************************************************************************************************/
+  DYNARRAY_NODISCARD iterator begin() noexcept { return data_; }
+  DYNARRAY_NODISCARD const_iterator begin() const noexcept { return data_; }
+  DYNARRAY_NODISCARD iterator end() noexcept { return data_ + size_; }
+  DYNARRAY_NODISCARD const_iterator end() const noexcept { return data_ + size_; }
+  DYNARRAY_NODISCARD const_iterator cbegin() const noexcept { return data_; }
+  DYNARRAY_NODISCARD const_iterator cend() const noexcept { return data_ + size_; }
+  DYNARRAY_NODISCARD reverse_iterator rbegin() noexcept { return detail::make_reverse_iterator(this->end()); }
+  DYNARRAY_NODISCARD const_reverse_iterator rbegin() const noexcept { return detail::make_reverse_iterator(this->end()); }
+  DYNARRAY_NODISCARD reverse_iterator rend() noexcept { return detail::make_reverse_iterator(this->begin()); }
+  DYNARRAY_NODISCARD const_reverse_iterator rend() const noexcept { return detail::make_reverse_iterator(this->begin()); }
+  DYNARRAY_NODISCARD const_reverse_iterator crbegin() const noexcept { return detail::make_reverse_iterator(this->end()); }
+  DYNARRAY_NODISCARD const_reverse_iterator crend() const noexcept { return detail::make_reverse_iterator(this->begin()); }
+
+  /**************************************************************************************************************************************/
+  /**                                                             capacity                                                             **/
+  /**************************************************************************************************************************************/
+  DYNARRAY_NODISCARD bool empty() const noexcept { return size_ == 0; }
+  DYNARRAY_NODISCARD size_type size() const noexcept { return size_; }
+
+  /**************************************************************************************************************************************/
+  /**                                                            operations                                                            **/
+  /**************************************************************************************************************************************/
+  // the file descriptor of an anonymous shared memory object created by this shared_dynarray, -1 otherwise
+  DYNARRAY_NODISCARD int fd() const noexcept { return fd_; }
+  void swap(shared_dynarray& other) noexcept {
+    mapping_.swap(other.mapping_);
+    std::swap(data_, other.data_);
+    std::swap(size_, other.size_);
+    std::swap(fd_, other.fd_);
+    name_.swap(other.name_);
+  }
+  void fill(const value_type& value = value_type{}) {
+    assert((data_ != nullptr) && "Calling fill() is undefined for nullptr data!");
+    std::fill(this->begin(), this->end(), value);
+  }
+  void iota(const value_type& value = value_type{}) {
+    assert((data_ != nullptr) && "Calling iota() is undefined for nullptr data!");
+    std::iota(this->begin(), this->end(), value);
+  }
+  template <typename Generator>
+  void generate(Generator gen) {
+    assert((data_ != nullptr) && "Calling generate() is undefined for nullptr data!");
+    std::generate(this->begin(), this->end(), gen);
+  }
+
+  /**************************************************************************************************************************************/
+  /**                                                       non-member functions                                                       **/
+  /**************************************************************************************************************************************/
+#if defined(__cpp_impl_three_way_comparison) && defined(__cpp_lib_three_way_comparison)
+  DYNARRAY_NODISCARD friend bool operator==(const shared_dynarray& lhs, const shared_dynarray& rhs) noexcept {
+    return lhs.size() == rhs.size() && detail::equal_elements(lhs.data(), rhs.data(), lhs.size(), detail::is_bitwise_comparable<T>{});
+  }
+  DYNARRAY_NODISCARD friend std::strong_ordering operator<=>(const shared_dynarray& lhs, const shared_dynarray& rhs) noexcept {
+    return lhs.size() != rhs.size() ? lhs.size() <=> rhs.size()
+                                    : detail::lexicographical_compare_three_way(lhs.data(), lhs.size(), rhs.data(), rhs.size(),
+                                                                                detail::is_bitwise_comparable<T>{});
+  }
+#else
+  DYNARRAY_NODISCARD friend bool operator==(const shared_dynarray& lhs, const shared_dynarray& rhs) noexcept {
+    return lhs.size() == rhs.size() && detail::equal_elements(lhs.data(), rhs.data(), lhs.size(), detail::is_bitwise_comparable<T>{});
+  }
+  DYNARRAY_NODISCARD friend bool operator!=(const shared_dynarray& lhs, const shared_dynarray& rhs) noexcept { return !(lhs == rhs); }
+  DYNARRAY_NODISCARD friend bool operator<(const shared_dynarray& lhs, const shared_dynarray& rhs) noexcept {
+    return detail::lexicographical_less(lhs.data(), lhs.size(), rhs.data(), rhs.size(), detail::is_bitwise_comparable<T>{});
+  }
+  DYNARRAY_NODISCARD friend bool operator>(const shared_dynarray& lhs, const shared_dynarray& rhs) noexcept { return rhs < lhs; }
+  DYNARRAY_NODISCARD friend bool operator<=(const shared_dynarray& lhs, const shared_dynarray& rhs) noexcept { return !(rhs < lhs); }
+  DYNARRAY_NODISCARD friend bool operator>=(const shared_dynarray& lhs, const shared_dynarray& rhs) noexcept { return !(lhs < rhs); }
+#endif
+
+ private:
+  // a new shared memory object: writes the header
+  shared_dynarray(detail::file_mapping&& mapping, const size_type size)
+      : mapping_(std::move(mapping)), data_{ reinterpret_cast<pointer>(mapping_.data() + sizeof(detail::binary_header)) }, size_{ size } {
+    detail::binary_header header = detail::make_binary_header<T>(nullptr, 0);
+    header.count = size;
+    std::memcpy(mapping_.data(), &header, sizeof(header));
+  }
+  // an attached shared memory object with an already validated header
+  explicit shared_dynarray(detail::file_mapping&& mapping)
+      : mapping_(std::move(mapping)),
+        data_{ reinterpret_cast<pointer>(mapping_.data() + sizeof(detail::binary_header)) },
+        size_{ detail::shared_memory_count(mapping_) } {}
+
+  detail::file_mapping mapping_;
+  pointer data_{ nullptr };
+  size_type size_{ 0 };
+  int fd_{ -1 };
+  // the name of a named shared memory object created by this shared_dynarray (removed in the destructor)
+  std::string name_;
+};
+
+/**
+ * @brief A read-only view of a cpp_util::shared_dynarray created by another process (mapped with `PROT_READ`, i.e., writes through a
+ *        const_cast crash instead of modifying the shared elements). Modifications by the creator are visible immediately.
+ */
+template <typename T>
+class shared_dynarray<const T> {
+ public:
+  /**************************************************************************************************************************************/
+  /**                                                              types                                                               **/
+  /**************************************************************************************************************************************/
+  using value_type = T;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = const value_type&;
+  using const_reference = const value_type&;
+  using pointer = const value_type*;
+  using const_pointer = const value_type*;
+  using iterator = const_pointer;
+  using const_iterator = const_pointer;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable elements can be shared between processes");
+  static_assert(alignof(T) <= sizeof(detail::binary_header), "The elements in the shared memory are only aligned to 64 bytes");
+
+  /**************************************************************************************************************************************/
+  /**                                                           construction                                                           **/
+  /**************************************************************************************************************************************/
+  shared_dynarray() noexcept = default;
+  /**
+   * @brief Attaches to the named shared memory object @p name created by a cpp_util::shared_dynarray for reading.
+   * @throws std::system_error if the shared memory object can't be opened or mapped
+   * @throws std::runtime_error if the header doesn't match @p T or the shared memory is too small for the number of elements
+   */
+  DYNARRAY_NODISCARD static shared_dynarray attach(const std::string& name) {
+    return shared_dynarray{ detail::attach_shared_memory<T>(name, false) };
+  }
+  /**
+   * @brief Attaches to the shared memory object @p fd created by a cpp_util::shared_dynarray for reading. The caller keeps the ownership
+   *        of @p fd.
+   * @throws std::system_error if the shared memory object can't be mapped
+   * @throws std::runtime_error if the header doesn't match @p T or the shared memory is too small for the number of elements
+   */
+  DYNARRAY_NODISCARD static shared_dynarray attach(const int fd) { return shared_dynarray{ detail::attach_shared_memory<T>(fd, false) }; }
+  shared_dynarray(const shared_dynarray&) = delete;
+  shared_dynarray(shared_dynarray&& other) noexcept
+      : mapping_(std::move(other.mapping_)), data_{ detail::exchange(other.data_, nullptr) }, size_{ detail::exchange(other.size_, size_type{ 0 }) } {}
+
+  /**************************************************************************************************************************************/
+  /**                                                            assignment                                                            **/
+  /**************************************************************************************************************************************/
+  shared_dynarray& operator=(const shared_dynarray&) = delete;
+  shared_dynarray& operator=(shared_dynarray&& other) noexcept {
+    shared_dynarray tmp{ std::move(other) };
+    this->swap(tmp);
+    return *this;
+  }
+
+  /**************************************************************************************************************************************/
+  /**                                                          element access                                                          **/
+  /**************************************************************************************************************************************/
+  DYNARRAY_NODISCARD const_reference at(const size_type pos) const {
+    if (pos >= size_) throw std::out_of_range{ "Index out-of-range: pos >= this->size()" };
+    return data_[pos];
+  }
+  DYNARRAY_NODISCARD const_reference operator[](const size_type pos) const {
+    assert((pos < size_) && "Undefined behavior if pos >= this->size()!");
+    return data_[pos];
+  }
+  DYNARRAY_NODISCARD const_reference front() const {
+    assert((!this->empty()) && "Calling front() is undefined for empty dynarrays!");
+    return data_[0];
+  }
+  DYNARRAY_NODISCARD const_reference back() const {
+    assert((!this->empty()) && "Calling back() is undefined for empty dynarrays!");
+    return data_[size_ - 1];
+  }
+  DYNARRAY_NODISCARD const_pointer data() const noexcept { return data_; }
+
+  /**************************************************************************************************************************************/
+  /**                                                         iterator support                                                         **/
+  /**************************************************************************************************************************************/
+  DYNARRAY_NODISCARD const_iterator begin() const noexcept { return data_; }
+  DYNARRAY_NODISCARD const_iterator end() const noexcept { return data_ + size_; }
+  DYNARRAY_NODISCARD const_iterator cbegin() const noexcept { return data_; }
+  DYNARRAY_NODISCARD const_iterator cend() const noexcept { return data_ + size_; }
+  DYNARRAY_NODISCARD const_reverse_iterator rbegin() const noexcept { return detail::make_reverse_iterator(this->end()); }
+  DYNARRAY_NODISCARD const_reverse_iterator rend() const noexcept { return detail::make_reverse_iterator(this->begin()); }
+  DYNARRAY_NODISCARD const_reverse_iterator crbegin() const noexcept { return detail::make_reverse_iterator(this->end()); }
+  DYNARRAY_NODISCARD const_reverse_iterator crend() const noexcept { return detail::make_reverse_iterator(this->begin()); }
+
+  /**************************************************************************************************************************************/
+  /**                                                             capacity                                                             **/
+  /**************************************************************************************************************************************/
+  DYNARRAY_NODISCARD bool empty() const noexcept { return size_ == 0; }
+  DYNARRAY_NODISCARD size_type size() const noexcept { return size_; }
+
+  /**************************************************************************************************************************************/
+  /**                                                            operations                                                            **/
+  /**************************************************************************************************************************************/
+  void swap(shared_dynarray& other) noexcept {
+    mapping_.swap(other.mapping_);
+    std::swap(data_, other.data_);
+    std::swap(size_, other.size_);
+  }
+
+  /**************************************************************************************************************************************/
+  /**                                                       non-member functions                                                       **/
+  /**************************************************************************************************************************************/
+#if defined(__cpp_impl_three_way_comparison) && defined(__cpp_lib_three_way_comparison)
+  DYNARRAY_NODISCARD friend bool operator==(const shared_dynarray& lhs, const shared_dynarray& rhs) noexcept {
+    return lhs.size() == rhs.size() && detail::equal_elements(lhs.data(), rhs.data(), lhs.size(), detail::is_bitwise_comparable<T>{});
+  }
+  DYNARRAY_NODISCARD friend std::strong_ordering operator<=>(const shared_dynarray& lhs, const shared_dynarray& rhs) noexcept {
+    return lhs.size() != rhs.size() ? lhs.size() <=> rhs.size()
+                                    : detail::lexicographical_compare_three_way(lhs.data(), lhs.size(), rhs.data(), rhs.size(),
+                                                                                detail::is_bitwise_comparable<T>{});
+  }
+#else
+  DYNARRAY_NODISCARD friend bool operator==(const shared_dynarray& lhs, const shared_dynarray& rhs) noexcept {
+    return lhs.size() == rhs.size() && detail::equal_elements(lhs.data(), rhs.data(), lhs.size(), detail::is_bitwise_comparable<T>{});
+  }
+  DYNARRAY_NODISCARD friend bool operator!=(const shared_dynarray& lhs, const shared_dynarray& rhs) noexcept { return !(lhs == rhs); }
+  DYNARRAY_NODISCARD friend bool operator<(const shared_dynarray& lhs, const shared_dynarray& rhs) noexcept {
+    return detail::lexicographical_less(lhs.data(), lhs.size(), rhs.data(), rhs.size(), detail::is_bitwise_comparable<T>{});
+  }
+  DYNARRAY_NODISCARD friend bool operator>(const shared_dynarray& lhs, const shared_dynarray& rhs) noexcept { return rhs < lhs; }
+  DYNARRAY_NODISCARD friend bool operator<=(const shared_dynarray& lhs, const shared_dynarray& rhs) noexcept { return !(rhs < lhs); }
+  DYNARRAY_NODISCARD friend bool operator>=(const shared_dynarray& lhs, const shared_dynarray& rhs) noexcept { return !(lhs < rhs); }
+#endif
+
+ private:
+  // an attached shared memory object with an already validated header
+  explicit shared_dynarray(detail::file_mapping&& mapping)
+      : mapping_(std::move(mapping)),
+        data_{ reinterpret_cast<const_pointer>(mapping_.data() + sizeof(detail::binary_header)) },
+        size_{ detail::shared_memory_count(mapping_) } {}
+
+  detail::file_mapping mapping_;
+  const_pointer data_{ nullptr };
+  size_type size_{ 0 };
+};
+
+template <typename T>
+void swap(shared_dynarray<T>& lhs, shared_dynarray<T>& rhs) noexcept {
+  lhs.swap(rhs);
+}
+
+}  // namespace cpp_util
+
+#endif
+
+#endif  // CPP_UTIL_SHARED_DYNARRAY_HPP
@@ -0,0 +1,336 @@
+/**
+ * Copyright (C) 2021 - Marcel Breyer - All Rights Reserved
+ * Licensed under the MIT License. See LICENSE.md file in the project root for full license information.
+ *
+ * Implements a runtime fixed-size array storing up to N elements inline without a heap allocation.
+ */
+
+#ifndef CPP_UTIL_SMALL_DYNARRAY_HPP
+#define CPP_UTIL_SMALL_DYNARRAY_HPP
+
+#include "dynarray.hpp"
+
+#include <algorithm>         // std::fill, std::copy, std::generate
+#include <cassert>           // assert
+#include <cstddef>           // std::size_t, std::ptrdiff_t
+#include <cstring>           // std::memcpy
+#include <initializer_list>  // std::initializer_list
+#include <iterator>          // std::reverse_iterator, std::distance, std::iterator_traits, std::forward_iterator_tag,
+                             // std::make_move_iterator
+#include <limits>            // std::numeric_limits
+#include <memory>            // std::allocator, std::addressof, std::uninitialized_copy, std::uninitialized_fill
+#include <new>               // placement new
+#include <numeric>           // std::iota
+#include <stdexcept>         // std::out_of_range
+#include <type_traits>       // std::enable_if, std::is_convertible, std::is_same, std::remove_cv, std::is_nothrow_move_constructible,
+                             // std::is_trivially_default_constructible, std::is_trivially_copyable, std::true_type, std::false_type
+#include <utility>           // std::move
+
+#if __has_include(<compare>)
+#include <compare>  // std::strong_ordering
+#endif
+
+namespace cpp_util {
+
+/**
+ * @brief A runtime fixed-size array like cpp_util::dynarray, which stores up to @p N elements inline, i.e., only arrays with more than
+ *        @p N elements allocate their memory (using `std::allocator<T>`). Moving an array with heap storage only moves the pointer.
+ *        Moving an array with inline storage copies the whole inline buffer with a single `std::memcpy` if @p T is trivially
+ *        copyable and moves the elements one by one otherwise. Like cpp_util::dynarray, a moved-from array is empty.
+ */
+template <typename T, std::size_t N>
+class small_dynarray {
+  static_assert(N > 0, "cpp_util::small_dynarray requires at least one inline element");
+
+ public:
+  /**************************************************************************************************************************************/
+  /**                                                              types                                                               **/
+  /**************************************************************************************************************************************/
+  using value_type = T;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using pointer = value_type*;
+  using const_pointer = const value_type*;
+  using iterator = pointer;
+  using const_iterator = const_pointer;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  static_assert(std::is_same<typename std::remove_cv<value_type>::type, value_type>::value,
+                "cpp_util::small_dynarray must have a non-const, non-volatile value_type");
+
+  /**************************************************************************************************************************************/
+  /**                                                           construction                                                           **/
+  /**************************************************************************************************************************************/
+  small_dynarray() noexcept : data_{ this->inline_data() } {}
+  explicit small_dynarray(const size_type size) : small_dynarray(size, value_init) {}
+  small_dynarray(const size_type size, value_init_t) : size_{ size }, data_{ this->allocate_storage(size) } {
+    // value-initialize all elements
+    this->construct_elements([](pointer ptr) { ::new (static_cast<void*>(ptr)) value_type(); });
+  }
+  small_dynarray(const size_type size, for_overwrite_t) : size_{ size }, data_{ this->allocate_storage(size) } {
+    // default-initialize all elements
+    if (!std::is_trivially_default_constructible<value_type>::value) {
+      this->construct_elements([](pointer ptr) { ::new (static_cast<void*>(ptr)) value_type; });
+    }
+  }
+  small_dynarray(const size_type size, const value_type& init) : size_{ size }, data_{ this->allocate_storage(size) } {
+    // initialize with same value
+    this->construct_elements_from([&]() { std::uninitialized_fill(data_, data_ + size_, init); });
+  }
+  template <typename ForwardIt, typename std::enable_if<std::is_convertible<typename std::iterator_traits<ForwardIt>::iterator_category,
+                                                                            std::forward_iterator_tag>::value,
+                                                        bool>::type = true>
+  small_dynarray(ForwardIt first, ForwardIt last)
+      : size_{ static_cast<size_type>(std::distance(first, last)) }, data_{ this->allocate_storage(size_) } {
+    // copy values from iterator range (trivially copyable types result in a single std::memmove)
+    this->construct_elements_from([&]() { std::uninitialized_copy(first, last, data_); });
+  }
+  small_dynarray(std::initializer_list<value_type> ilist) : small_dynarray(ilist.begin(), ilist.end()) {}
+  small_dynarray(const small_dynarray& other) : small_dynarray(other.cbegin(), other.cend()) {}
+  small_dynarray(small_dynarray&& other) noexcept(std::is_nothrow_move_constructible<value_type>::value) : data_{ this->inline_data() } {
+    this->steal_storage(other);
+  }
+
+  /**************************************************************************************************************************************/
+  /**                                                           destruction                                                            **/
+  /**************************************************************************************************************************************/
+  ~small_dynarray() { this->release_storage(); }
+
+  /**************************************************************************************************************************************/
+  /**                                                            assignment                                                            **/
+  /**************************************************************************************************************************************/
+  small_dynarray& operator=(const small_dynarray& other) {
+    // guard against self assignment
+    if (this != std::addressof(other)) {
+      this->assign(other.cbegin(), other.cend());
+    }
+    return *this;
+  }
+  small_dynarray& operator=(small_dynarray&& other) noexcept(std::is_nothrow_move_constructible<value_type>::value) {
+    // guard against self assignment
+    if (this != std::addressof(other)) {
+      this->release_storage();
+      this->steal_storage(other);
+    }
+    return *this;
+  }
+  small_dynarray& operator=(std::initializer_list<value_type> ilist) {
+    this->assign(ilist.begin(), ilist.end());
+    return *this;
+  }
+
+  void assign(const size_type count, const value_type& value) {
+    // if sizes mismatch create new storage, otherwise just directly assign new values
+    if (count != size_) {
+      small_dynarray tmp(count, value);
+      *this = std::move(tmp);
+    } else {
+      this->fill(value);
+    }
+  }
+  template <typename ForwardIt, typename std::enable_if<std::is_convertible<typename std::iterator_traits<ForwardIt>::iterator_category,
+                                                                            std::forward_iterator_tag>::value,
+                                                        bool>::type = true>
+  void assign(ForwardIt first, ForwardIt last) {
+    // if sizes mismatch create new storage, otherwise just directly assign new values
+    if (static_cast<size_type>(std::distance(first, last)) != size_) {
+      small_dynarray tmp(first, last);
+      *this = std::move(tmp);
+    } else {
+      std::copy(first, last, this->begin());
+    }
+  }
+  void assign(std::initializer_list<value_type> ilist) { this->assign(ilist.begin(), ilist.end()); }
+
+  /**************************************************************************************************************************************/
+  /**                                                          element access                                                          **/
+  /**************************************************************************************************************************************/
+  DYNARRAY_NODISCARD reference at(const size_type pos) {
+    if (pos >= size_) throw std::out_of_range{ "Index out-of-range: pos >= this->size()" };
+    return data_[pos];
+  }
+  DYNARRAY_NODISCARD const_reference at(const size_type pos) const {
+    if (pos >= size_) throw std::out_of_range{ "Index out-of-range: pos >= this->size()" };
+    return data_[pos];
+  }
+  DYNARRAY_NODISCARD reference operator[](const size_type pos) {
+    assert((pos < this->size()) && "Undefined behavior if pos >= this->size()!");
+    return data_[pos];
+  }
+  DYNARRAY_NODISCARD const_reference operator[](const size_type pos) const {
+    assert((pos < this->size()) && "Undefined behavior if pos >= this->size()!");
+    return data_[pos];
+  }
+  DYNARRAY_NODISCARD reference front() {
+    assert((!this->empty()) && "Calling front() is undefined for empty small_dynarrays!");
+    return data_[0];
+  }
+  DYNARRAY_NODISCARD const_reference front() const {
+    assert((!this->empty()) && "Calling front() is undefined for empty small_dynarrays!");
+    return data_[0];
+  }
+  DYNARRAY_NODISCARD reference back() {
+    assert((!this->empty()) && "Calling back() is undefined for empty small_dynarrays!");
+    return data_[size_ - 1];
+  }
+  DYNARRAY_NODISCARD const_reference back() const {
+    assert((!this->empty()) && "Calling back() is undefined for empty small_dynarrays!");
+    return data_[size_ - 1];
+  }
+  DYNARRAY_NODISCARD pointer data() noexcept { return data_; }
+  DYNARRAY_NODISCARD const_pointer data() const noexcept { return data_; }
+
+  /**************************************************************************************************************************************/
+  /**                                                         iterator support                                                         **/
+  /**************************************************************************************************************************************/
+  DYNARRAY_NODISCARD iterator begin() noexcept { return data_; }
+  DYNARRAY_NODISCARD iterator end() noexcept { return data_ + size_; }
+  DYNARRAY_NODISCARD const_iterator begin() const noexcept { return data_; }
+  DYNARRAY_NODISCARD const_iterator end() const noexcept { return data_ + size_; }
+  DYNARRAY_NODISCARD const_iterator cbegin() const noexcept { return data_; }
+  DYNARRAY_NODISCARD const_iterator cend() const noexcept { return data_ + size_; }
+  DYNARRAY_NODISCARD reverse_iterator rbegin() noexcept { return detail::make_reverse_iterator(this->end()); }
+  DYNARRAY_NODISCARD reverse_iterator rend() noexcept { return detail::make_reverse_iterator(this->begin()); }
+  DYNARRAY_NODISCARD const_reverse_iterator rbegin() const noexcept { return detail::make_reverse_iterator(this->end()); }
+  DYNARRAY_NODISCARD const_reverse_iterator rend() const noexcept { return detail::make_reverse_iterator(this->begin()); }
+  DYNARRAY_NODISCARD const_reverse_iterator crbegin() const noexcept { return detail::make_reverse_iterator(this->end()); }
+  DYNARRAY_NODISCARD const_reverse_iterator crend() const noexcept { return detail::make_reverse_iterator(this->begin()); }
+
+  /**************************************************************************************************************************************/
+  /**                                                             capacity                                                             **/
+  /**************************************************************************************************************************************/
+  DYNARRAY_NODISCARD bool empty() const noexcept { return size_ == 0; }
+  DYNARRAY_NODISCARD size_type size() const noexcept { return size_; }
+  DYNARRAY_NODISCARD static constexpr size_type max_size() noexcept {
+    return std::numeric_limits<difference_type>::max() / sizeof(value_type);
+  }
+  DYNARRAY_NODISCARD static constexpr size_type inline_capacity() noexcept { return N; }
+  // true if the elements are stored inside the object itself
+  DYNARRAY_NODISCARD bool is_inline() const noexcept { return size_ <= N; }
+
+  /**************************************************************************************************************************************/
+  /**                                                            operations                                                            **/
+  /**************************************************************************************************************************************/
+  void swap(small_dynarray& other) noexcept(std::is_nothrow_move_constructible<value_type>::value) {
+    small_dynarray tmp{ std::move(other) };
+    other = std::move(*this);
+    *this = std::move(tmp);
+  }
+  void fill(const value_type& value = value_type{}) { std::fill(this->begin(), this->end(), value); }
+  void iota(const value_type& value = value_type{}) { std::iota(this->begin(), this->end(), value); }
+  template <typename Generator>
+  void generate(Generator gen) {
+    std::generate(this->begin(), this->end(), gen);
+  }
+
+  /**************************************************************************************************************************************/
+  /**                                                       non-member functions                                                       **/
+  /**************************************************************************************************************************************/
+  // integral and byte element types are compared using std::memcmp or SSE2 (see detail::lexicographical_compare_bitwise)
+#if defined(__cpp_impl_three_way_comparison) && defined(__cpp_lib_three_way_comparison)
+  DYNARRAY_NODISCARD friend bool operator==(const small_dynarray& lhs, const small_dynarray& rhs) noexcept {
+    return lhs.size() == rhs.size() && detail::equal_elements(lhs.data(), rhs.data(), lhs.size(), detail::is_bitwise_comparable<T>{});
+  }
+  DYNARRAY_NODISCARD friend std::strong_ordering operator<=>(const small_dynarray& lhs, const small_dynarray& rhs) noexcept {
+    return lhs.size() != rhs.size() ? lhs.size() <=> rhs.size()
+                                    : detail::lexicographical_compare_three_way(lhs.data(), lhs.size(), rhs.data(), rhs.size(),
+                                                                                detail::is_bitwise_comparable<T>{});
+  }
+#else
+  DYNARRAY_NODISCARD friend bool operator==(const small_dynarray& lhs, const small_dynarray& rhs) noexcept {
+    return lhs.size() == rhs.size() && detail::equal_elements(lhs.data(), rhs.data(), lhs.size(), detail::is_bitwise_comparable<T>{});
+  }
+  DYNARRAY_NODISCARD friend bool operator!=(const small_dynarray& lhs, const small_dynarray& rhs) noexcept { return !(lhs == rhs); }
+  DYNARRAY_NODISCARD friend bool operator<(const small_dynarray& lhs, const small_dynarray& rhs) noexcept {
+    return detail::lexicographical_less(lhs.data(), lhs.size(), rhs.data(), rhs.size(), detail::is_bitwise_comparable<T>{});
+  }
+  DYNARRAY_NODISCARD friend bool operator>(const small_dynarray& lhs, const small_dynarray& rhs) noexcept { return rhs < lhs; }
+  DYNARRAY_NODISCARD friend bool operator<=(const small_dynarray& lhs, const small_dynarray& rhs) noexcept { return !(rhs < lhs); }
+  DYNARRAY_NODISCARD friend bool operator>=(const small_dynarray& lhs, const small_dynarray& rhs) noexcept { return !(lhs < rhs); }
+#endif
+
+ private:
+  /**************************************************************************************************************************************/
+  /**                                                        memory management                                                         **/
+  /**************************************************************************************************************************************/
+  pointer inline_data() noexcept { return reinterpret_cast<pointer>(buffer_); }
+  pointer allocate_storage(const size_type size) { return size <= N ? this->inline_data() : std::allocator<value_type>{}.allocate(size); }
+  void deallocate_storage() noexcept {
+    if (size_ > N) {
+      std::allocator<value_type>{}.deallocate(data_, size_);
+    }
+  }
+  // construct every element using construct(ptr); on failure, the already constructed elements are destroyed
+  template <typename Construct>
+  void construct_elements(Construct construct) {
+    size_type constructed = 0;
+    try {
+      for (; constructed < size_; ++constructed) {
+        construct(data_ + constructed);
+      }
+    } catch (...) {
+      // the destructor won't run for a partially constructed small_dynarray -> clean up before rethrowing
+      this->destroy_elements(data_, data_ + constructed);
+      this->deallocate_storage();
+      throw;
+    }
+  }
+  // the uninitialized algorithms already destroy the constructed elements on failure
+  template <typename Construct>
+  void construct_elements_from(Construct construct) {
+    try {
+      construct();
+    } catch (...) {
+      this->deallocate_storage();
+      throw;
+    }
+  }
+  static void destroy_elements(pointer first, pointer last) noexcept {
+    for (; first != last; ++first) {
+      first->~value_type();
+    }
+  }
+  void release_storage() noexcept {
+    this->destroy_elements(data_, data_ + size_);
+    this->deallocate_storage();
+    size_ = 0;
+    data_ = this->inline_data();
+  }
+  // requires our storage to be empty and inline; leaves other empty
+  void steal_storage(small_dynarray& other) noexcept(std::is_nothrow_move_constructible<value_type>::value) {
+    if (other.size_ > N) {
+      // heap storage -> steal the pointer
+      size_ = detail::exchange(other.size_, size_type{ 0 });
+      data_ = detail::exchange(other.data_, other.inline_data());
+    } else {
+      this->move_inline_elements(other, std::is_trivially_copyable<value_type>{});
+    }
+  }
+  void move_inline_elements(small_dynarray& other, std::true_type) noexcept {
+    // copying the whole buffer has a compile-time size and avoids a loop over the elements
+    std::memcpy(buffer_, other.buffer_, sizeof(buffer_));
+    size_ = detail::exchange(other.size_, size_type{ 0 });
+  }
+  void move_inline_elements(small_dynarray& other, std::false_type) noexcept(std::is_nothrow_move_constructible<value_type>::value) {
+    // move the elements one by one (on failure, the already moved elements are destroyed and we stay empty)
+    std::uninitialized_copy(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()), data_);
+    size_ = other.size_;
+    other.release_storage();
+  }
+
+  size_type size_{ 0 };
+  pointer data_;
+  alignas(value_type) unsigned char buffer_[N * sizeof(value_type)];
+};
+
+template <typename T, std::size_t N>
+void swap(small_dynarray<T, N>& lhs, small_dynarray<T, N>& rhs) noexcept(noexcept(lhs.swap(rhs))) {
+  lhs.swap(rhs);
+}
+
+}  // namespace cpp_util
+
+#endif  // CPP_UTIL_SMALL_DYNARRAY_HPP
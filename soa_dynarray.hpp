@@ -0,0 +1,419 @@
+/**
+ * Copyright (C) 2021 - Marcel Breyer - All Rights Reserved
+ * Licensed under the MIT License. See LICENSE.md file in the project root for full license information.
+ *
+ * Implements a runtime fixed-size array storing each field of its elements in a separate contiguous array (struct of arrays).
+ */
+
+#ifndef CPP_UTIL_SOA_DYNARRAY_HPP
+#define CPP_UTIL_SOA_DYNARRAY_HPP
+
+#include "dynarray.hpp"
+
+#include <algorithm>    // std::fill, std::equal
+#include <cassert>      // assert
+#include <cstddef>      // std::size_t, std::ptrdiff_t
+#include <iterator>     // std::input_iterator_tag, std::random_access_iterator_tag
+#include <limits>       // std::numeric_limits
+#include <new>          // placement new
+#include <stdexcept>    // std::out_of_range, std::length_error
+#include <tuple>        // std::tuple, std::tuple_element, std::get
+#include <type_traits>  // std::conditional, std::enable_if, std::is_same, std::is_trivially_default_constructible, std::remove_cv
+#include <utility>      // std::move
+
+namespace cpp_util {
+
+namespace detail {
+
+// std::index_sequence and std::make_index_sequence are only available since C++14
+template <std::size_t... Is>
+struct index_sequence {};
+template <std::size_t N, std::size_t... Is>
+struct make_index_sequence_impl : make_index_sequence_impl<N - 1, N - 1, Is...> {};
+template <std::size_t... Is>
+struct make_index_sequence_impl<0, Is...> {
+  using type = index_sequence<Is...>;
+};
+template <std::size_t N>
+using make_index_sequence = typename make_index_sequence_impl<N>::type;
+
+// evaluates a pack expansion of expressions in order, e.g., `(void) expand_pack{ 0, (func<Is>(), 0)... };`
+using expand_pack = int[];
+
+template <bool... Bs>
+struct bool_pack {};
+template <bool... Bs>
+using all_true = std::is_same<bool_pack<true, Bs...>, bool_pack<Bs..., true>>;
+
+}  // namespace detail
+
+/**
+ * @brief A runtime fixed-size array of elements with the fields @p Fields stored as a struct of arrays, i.e., each field is stored in
+ *        its own contiguous array aligned to a cache line. All arrays share a single size and a single allocation. Element access
+ *        returns a `std::tuple` of references (proxy reference), the array of a single field is accessible via `field<I>()`.
+ */
+template <typename... Fields>
+class soa_dynarray {
+  static_assert(sizeof...(Fields) > 0, "cpp_util::soa_dynarray requires at least one field");
+  static_assert(detail::all_true<std::is_same<typename std::remove_cv<Fields>::type, Fields>::value...>::value,
+                "cpp_util::soa_dynarray must have non-const, non-volatile fields");
+  static_assert(detail::all_true<(alignof(Fields) <= detail::cache_line_size)...>::value,
+                "cpp_util::soa_dynarray can't store fields aligned to more than a cache line");
+
+  using indices = detail::make_index_sequence<sizeof...(Fields)>;
+  // all field arrays are padded to a multiple of the cache line size, i.e., they never share a cache line
+  using storage_allocator = aligned_allocator<unsigned char, detail::cache_line_size, true>;
+
+ public:
+  /**************************************************************************************************************************************/
+  /**                                                              types                                                               **/
+  /**************************************************************************************************************************************/
+  using value_type = std::tuple<Fields...>;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = std::tuple<Fields&...>;
+  using const_reference = std::tuple<const Fields&...>;
+  template <std::size_t I>
+  using field_type = typename std::tuple_element<I, value_type>::type;
+
+  /**
+   * @brief Proxy iterator over the elements of a cpp_util::soa_dynarray yielding tuples of references. It supports all random access
+   *        operations, but since its reference isn't a real reference its iterator_category is std::input_iterator_tag; with C++20 its
+   *        iterator_concept is std::random_access_iterator_tag, so that the ranges algorithms can use its full capability.
+   */
+  template <bool Const>
+  class basic_iterator {
+    using array_pointer = typename std::conditional<Const, const soa_dynarray*, soa_dynarray*>::type;
+    template <bool>
+    friend class basic_iterator;
+
+   public:
+    using iterator_category = std::input_iterator_tag;
+#if defined(__cpp_lib_ranges)
+    using iterator_concept = std::random_access_iterator_tag;
+#endif
+    using value_type = std::tuple<Fields...>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = typename std::conditional<Const, std::tuple<const Fields&...>, std::tuple<Fields&...>>::type;
+
+    basic_iterator() = default;
+    basic_iterator(array_pointer arr, const size_type pos) noexcept : arr_{ arr }, pos_{ pos } {}
+    // an iterator is implicitly convertible to a const_iterator
+    template <bool C = Const, typename std::enable_if<C, bool>::type = true>
+    basic_iterator(const basic_iterator<false>& other) noexcept : arr_{ other.arr_ }, pos_{ other.pos_ } {}
+
+    DYNARRAY_NODISCARD reference operator*() const { return (*arr_)[pos_]; }
+    DYNARRAY_NODISCARD reference operator[](const difference_type n) const { return (*arr_)[static_cast<size_type>(pos_ + n)]; }
+
+    basic_iterator& operator++() noexcept {
+      ++pos_;
+      return *this;
+    }
+    basic_iterator operator++(int) noexcept {
+      basic_iterator tmp{ *this };
+      ++pos_;
+      return tmp;
+    }
+    basic_iterator& operator--() noexcept {
+      --pos_;
+      return *this;
+    }
+    basic_iterator operator--(int) noexcept {
+      basic_iterator tmp{ *this };
+      --pos_;
+      return tmp;
+    }
+    basic_iterator& operator+=(const difference_type n) noexcept {
+      pos_ = static_cast<size_type>(pos_ + n);
+      return *this;
+    }
+    basic_iterator& operator-=(const difference_type n) noexcept {
+      pos_ = static_cast<size_type>(pos_ - n);
+      return *this;
+    }
+    DYNARRAY_NODISCARD friend basic_iterator operator+(basic_iterator it, const difference_type n) noexcept { return it += n; }
+    DYNARRAY_NODISCARD friend basic_iterator operator+(const difference_type n, basic_iterator it) noexcept { return it += n; }
+    DYNARRAY_NODISCARD friend basic_iterator operator-(basic_iterator it, const difference_type n) noexcept { return it -= n; }
+    DYNARRAY_NODISCARD friend difference_type operator-(const basic_iterator& lhs, const basic_iterator& rhs) noexcept {
+      return static_cast<difference_type>(lhs.pos_ - rhs.pos_);
+    }
+
+    DYNARRAY_NODISCARD friend bool operator==(const basic_iterator& lhs, const basic_iterator& rhs) noexcept { return lhs.pos_ == rhs.pos_; }
+    DYNARRAY_NODISCARD friend bool operator!=(const basic_iterator& lhs, const basic_iterator& rhs) noexcept { return lhs.pos_ != rhs.pos_; }
+    DYNARRAY_NODISCARD friend bool operator<(const basic_iterator& lhs, const basic_iterator& rhs) noexcept { return lhs.pos_ < rhs.pos_; }
+    DYNARRAY_NODISCARD friend bool operator>(const basic_iterator& lhs, const basic_iterator& rhs) noexcept { return lhs.pos_ > rhs.pos_; }
+    DYNARRAY_NODISCARD friend bool operator<=(const basic_iterator& lhs, const basic_iterator& rhs) noexcept { return lhs.pos_ <= rhs.pos_; }
+    DYNARRAY_NODISCARD friend bool operator>=(const basic_iterator& lhs, const basic_iterator& rhs) noexcept { return lhs.pos_ >= rhs.pos_; }
+
+   private:
+    array_pointer arr_{ nullptr };
+    size_type pos_{ 0 };
+  };
+  using iterator = basic_iterator<false>;
+  using const_iterator = basic_iterator<true>;
+
+  /**************************************************************************************************************************************/
+  /**                                                           construction                                                           **/
+  /**************************************************************************************************************************************/
+  soa_dynarray() noexcept = default;
+  explicit soa_dynarray(const size_type size) : soa_dynarray(size, value_init) {}
+  soa_dynarray(const size_type size, value_init_t) : size_{ size } { this->construct_fields(value_initializer{}, indices{}); }
+  soa_dynarray(const size_type size, for_overwrite_t) : size_{ size } { this->construct_fields(default_initializer{}, indices{}); }
+  soa_dynarray(const size_type size, const value_type& init) : size_{ size } {
+    this->construct_fields(copy_initializer<value_type>{ init }, indices{});
+  }
+  soa_dynarray(const soa_dynarray& other) : size_{ other.size_ } { this->construct_fields(copy_initializer<soa_dynarray>{ other }, indices{}); }
+  soa_dynarray(soa_dynarray&& other) noexcept
+      : data_{ detail::exchange(other.data_, std::tuple<Fields*...>{}) }, size_{ detail::exchange(other.size_, size_type{ 0 }) } {}
+
+  /**************************************************************************************************************************************/
+  /**                                                           destruction                                                            **/
+  /**************************************************************************************************************************************/
+  ~soa_dynarray() { this->destroy_storage(sizeof...(Fields), indices{}); }
+
+  /**************************************************************************************************************************************/
+  /**                                                            assignment                                                            **/
+  /**************************************************************************************************************************************/
+  soa_dynarray& operator=(const soa_dynarray& rhs) {
+    if (this != &rhs) {
+      soa_dynarray tmp{ rhs };
+      this->swap(tmp);
+    }
+    return *this;
+  }
+  soa_dynarray& operator=(soa_dynarray&& rhs) noexcept {
+    soa_dynarray tmp{ std::move(rhs) };
+    this->swap(tmp);
+    return *this;
+  }
+
+  /**************************************************************************************************************************************/
+  /**                                                          element access                                                          **/
+  /**************************************************************************************************************************************/
+  DYNARRAY_NODISCARD reference at(const size_type pos) {
+    if (pos >= size_) throw std::out_of_range{ "Index out-of-range: pos >= this->size()" };
+    return (*this)[pos];
+  }
+  DYNARRAY_NODISCARD const_reference at(const size_type pos) const {
+    if (pos >= size_) throw std::out_of_range{ "Index out-of-range: pos >= this->size()" };
+    return (*this)[pos];
+  }
+  DYNARRAY_NODISCARD reference operator[](const size_type pos) {
+    assert((pos < this->size()) && "Undefined behavior if pos >= this->size()!");
+    return this->element<reference>(pos, indices{});
+  }
+  DYNARRAY_NODISCARD const_reference operator[](const size_type pos) const {
+    assert((pos < this->size()) && "Undefined behavior if pos >= this->size()!");
+    return this->element<const_reference>(pos, indices{});
+  }
+  DYNARRAY_NODISCARD reference front() {
+    assert((!this->empty()) && "Calling front() is undefined for empty soa_dynarrays!");
+    return (*this)[0];
+  }
+  DYNARRAY_NODISCARD const_reference front() const {
+    assert((!this->empty()) && "Calling front() is undefined for empty soa_dynarrays!");
+    return (*this)[0];
+  }
+  DYNARRAY_NODISCARD reference back() {
+    assert((!this->empty()) && "Calling back() is undefined for empty soa_dynarrays!");
+    return (*this)[size_ - 1];
+  }
+  DYNARRAY_NODISCARD const_reference back() const {
+    assert((!this->empty()) && "Calling back() is undefined for empty soa_dynarrays!");
+    return (*this)[size_ - 1];
+  }
+  // the contiguous array of the I-th field (aligned to a cache line)
+  template <std::size_t I>
+  DYNARRAY_NODISCARD field_type<I>* data() noexcept {
+    return std::get<I>(data_);
+  }
+  template <std::size_t I>
+  DYNARRAY_NODISCARD const field_type<I>* data() const noexcept {
+    return std::get<I>(data_);
+  }
+  template <std::size_t I>
+  DYNARRAY_NODISCARD row_view<field_type<I>> field() noexcept {
+    return row_view<field_type<I>>{ std::get<I>(data_), size_ };
+  }
+  template <std::size_t I>
+  DYNARRAY_NODISCARD row_view<const field_type<I>> field() const noexcept {
+    return row_view<const field_type<I>>{ std::get<I>(data_), size_ };
+  }
+
+  /**************************************************************************************************************************************/
+  /**                                                         iterator support                                                         **/
+  /**************************************************************************************************************************************/
+  DYNARRAY_NODISCARD iterator begin() noexcept { return iterator{ this, 0 }; }
+  DYNARRAY_NODISCARD iterator end() noexcept { return iterator{ this, size_ }; }
+  DYNARRAY_NODISCARD const_iterator begin() const noexcept { return const_iterator{ this, 0 }; }
+  DYNARRAY_NODISCARD const_iterator end() const noexcept { return const_iterator{ this, size_ }; }
+  DYNARRAY_NODISCARD const_iterator cbegin() const noexcept { return this->begin(); }
+  DYNARRAY_NODISCARD const_iterator cend() const noexcept { return this->end(); }
+
+  /**************************************************************************************************************************************/
+  /**                                                             capacity                                                             **/
+  /**************************************************************************************************************************************/
+  DYNARRAY_NODISCARD bool empty() const noexcept { return size_ == 0; }
+  DYNARRAY_NODISCARD size_type size() const noexcept { return size_; }
+  DYNARRAY_NODISCARD static constexpr size_type max_size() noexcept {
+    return (static_cast<size_type>(std::numeric_limits<difference_type>::max()) - (sizeof...(Fields) + 2) * detail::cache_line_size)
+           / element_bytes();
+  }
+  static constexpr size_type num_fields() noexcept { return sizeof...(Fields); }
+
+  /**************************************************************************************************************************************/
+  /**                                                            operations                                                            **/
+  /**************************************************************************************************************************************/
+  void swap(soa_dynarray& other) noexcept {
+    std::swap(data_, other.data_);
+    std::swap(size_, other.size_);
+  }
+  void fill(const value_type& value) { this->fill_fields(value, indices{}); }
+
+  DYNARRAY_NODISCARD friend bool operator==(const soa_dynarray& lhs, const soa_dynarray& rhs) {
+    return lhs.size_ == rhs.size_ && lhs.equal_fields(rhs, indices{});
+  }
+  DYNARRAY_NODISCARD friend bool operator!=(const soa_dynarray& lhs, const soa_dynarray& rhs) { return !(lhs == rhs); }
+
+ private:
+  // the elements of all fields are created by the same initializer, i.e., init.template construct<I>(ptr, pos)
+  struct value_initializer {
+    template <std::size_t I, typename F>
+    void construct(F* ptr, size_type) const {
+      ::new (static_cast<void*>(ptr)) F();
+    }
+  };
+  struct default_initializer {
+    template <std::size_t I, typename F>
+    void construct(F* ptr, size_type) const {
+      ::new (static_cast<void*>(ptr)) F;
+    }
+  };
+  template <typename Source>
+  struct copy_initializer {
+    const Source& source;
+
+    template <std::size_t I, typename F>
+    void construct(F* ptr, const size_type pos) const {
+      ::new (static_cast<void*>(ptr)) F(copy_initializer::get<I>(source, pos));
+    }
+    // copy the same value or the elements of another array
+    template <std::size_t I>
+    static const field_type<I>& get(const value_type& value, size_type) {
+      return std::get<I>(value);
+    }
+    template <std::size_t I>
+    static const field_type<I>& get(const soa_dynarray& other, const size_type pos) {
+      return other.template data<I>()[pos];
+    }
+  };
+
+  static constexpr size_type element_bytes() noexcept { return sum_sizes(sizeof(Fields)...); }
+  static constexpr size_type sum_sizes() noexcept { return 0; }
+  template <typename... Sizes>
+  static constexpr size_type sum_sizes(const size_type size, const Sizes... sizes) noexcept {
+    return size + sum_sizes(sizes...);
+  }
+  // the number of bytes of a field array padded to a multiple of the cache line size
+  template <typename F>
+  static size_type field_bytes(const size_type size) noexcept {
+    return (size * sizeof(F) + detail::cache_line_size - 1) & ~(detail::cache_line_size - 1);
+  }
+
+  template <typename Reference, std::size_t... Is>
+  Reference element(const size_type pos, detail::index_sequence<Is...>) const {
+    return Reference{ std::get<Is>(data_)[pos]... };
+  }
+
+  template <std::size_t... Is>
+  void fill_fields(const value_type& value, detail::index_sequence<Is...>) {
+    (void) detail::expand_pack{ 0, (std::fill(std::get<Is>(data_), std::get<Is>(data_) + size_, std::get<Is>(value)), 0)... };
+  }
+  template <std::size_t... Is>
+  bool equal_fields(const soa_dynarray& other, detail::index_sequence<Is...>) const {
+    bool equal = true;
+    (void) detail::expand_pack{ 0, (equal = equal && std::equal(std::get<Is>(data_), std::get<Is>(data_) + size_, std::get<Is>(other.data_)), 0)... };
+    return equal;
+  }
+
+  // allocate a single buffer and construct all elements of all fields (on exception, the already constructed fields are destroyed)
+  template <typename Initializer, std::size_t... Is>
+  void construct_fields(const Initializer& init, detail::index_sequence<Is...>) {
+    if (size_ == 0) {
+      return;
+    }
+    if (size_ > max_size()) {
+      throw std::length_error{ "Size exceeds max_size()" };
+    }
+    const size_type field_sizes[] = { field_bytes<Fields>(size_)... };
+    size_type total_bytes = 0;
+    for (const size_type bytes : field_sizes) {
+      total_bytes += bytes;
+    }
+    unsigned char* buffer = storage_allocator{}.allocate(total_bytes);
+    size_type offset = 0;
+    size_type field = 0;
+    (void) detail::expand_pack{ 0, (std::get<Is>(data_) = reinterpret_cast<Fields*>(buffer + offset), offset += field_sizes[field++], 0)... };
+
+    size_type constructed_fields = 0;
+    try {
+      (void) detail::expand_pack{ 0, (this->construct_field<Is>(init), ++constructed_fields, 0)... };
+    } catch (...) {
+      this->destroy_storage(constructed_fields, indices{});
+      size_ = 0;
+      throw;
+    }
+  }
+  template <std::size_t I, typename Initializer>
+  void construct_field(const Initializer& init) {
+    using F = field_type<I>;
+    F* ptr = std::get<I>(data_);
+    if (std::is_same<Initializer, default_initializer>::value && std::is_trivially_default_constructible<F>::value) {
+      return;
+    }
+    size_type pos = 0;
+    try {
+      for (; pos < size_; ++pos) {
+        init.template construct<I>(ptr + pos, pos);
+      }
+    } catch (...) {
+      destroy_elements(ptr, pos);
+      throw;
+    }
+  }
+
+  template <typename F>
+  static void destroy_elements(F* ptr, const size_type count) noexcept {
+    for (size_type pos = 0; pos < count; ++pos) {
+      ptr[pos].~F();
+    }
+  }
+  // destroy the elements of the first num_fields fields and deallocate the buffer
+  template <std::size_t... Is>
+  void destroy_storage(const size_type num_fields, detail::index_sequence<Is...>) noexcept {
+    if (std::get<0>(data_) == nullptr) {
+      return;
+    }
+    (void) detail::expand_pack{ 0, (Is < num_fields ? destroy_elements(std::get<Is>(data_), size_) : void(), 0)... };
+    const size_type field_sizes[] = { field_bytes<Fields>(size_)... };
+    size_type total_bytes = 0;
+    for (const size_type bytes : field_sizes) {
+      total_bytes += bytes;
+    }
+    storage_allocator{}.deallocate(reinterpret_cast<unsigned char*>(std::get<0>(data_)), total_bytes);
+    data_ = std::tuple<Fields*...>{};
+  }
+
+  std::tuple<Fields*...> data_{};
+  size_type size_{ 0 };
+};
+
+template <typename... Fields>
+void swap(soa_dynarray<Fields...>& lhs, soa_dynarray<Fields...>& rhs) noexcept {
+  lhs.swap(rhs);
+}
+
+}  // namespace cpp_util
+
+#endif  // CPP_UTIL_SOA_DYNARRAY_HPP
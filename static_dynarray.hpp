@@ -0,0 +1,241 @@
+/**
+ * Copyright (C) 2021 - Marcel Breyer - All Rights Reserved
+ * Licensed under the MIT License. See LICENSE.md file in the project root for full license information.
+ *
+ * Implements a heap allocated array with a compile-time size convertible from and to a cpp_util::dynarray.
+ */
+
+#ifndef CPP_UTIL_STATIC_DYNARRAY_HPP
+#define CPP_UTIL_STATIC_DYNARRAY_HPP
+
+#include "dynarray.hpp"
+
+#include <algorithm>         // std::fill_n, std::generate_n
+#include <cassert>           // assert
+#include <cstddef>           // std::size_t, std::ptrdiff_t
+#include <initializer_list>  // std::initializer_list
+#include <iterator>          // std::reverse_iterator, std::distance, std::iterator_traits, std::forward_iterator_tag
+#include <memory>            // std::allocator
+#include <numeric>           // std::iota
+#include <stdexcept>         // std::out_of_range, std::length_error
+#include <type_traits>       // std::enable_if, std::is_convertible, std::is_nothrow_move_assignable
+#include <utility>           // std::move
+
+#if __has_include(<compare>)
+#include <compare>  // std::strong_ordering
+#endif
+#if __has_include(<span>)
+#include <span>  // std::span
+#endif
+
+namespace cpp_util {
+
+/**
+ * @brief A heap allocated array of exactly @p Extent elements, i.e., size() is a compile-time constant and all loops over the elements
+ *        (fill, iota, generate, comparisons) have a constant trip count the compiler can unroll and vectorize. The elements are stored in a
+ *        cpp_util::dynarray; converting a cpp_util::dynarray of matching size (explicit) or to a cpp_util::dynarray (implicit) by move
+ *        transfers the buffer without copying. A moved-from cpp_util::static_dynarray owns no buffer and may only be assigned to or
+ *        destroyed.
+ */
+template <typename T, std::size_t Extent, typename Allocator = std::allocator<T>>
+class static_dynarray {
+ public:
+  /**************************************************************************************************************************************/
+  /**                                                              types                                                               **/
+  /**************************************************************************************************************************************/
+  using dynarray_type = dynarray<T, Allocator>;
+  using value_type = typename dynarray_type::value_type;
+  using allocator_type = typename dynarray_type::allocator_type;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = typename dynarray_type::reference;
+  using const_reference = typename dynarray_type::const_reference;
+  using pointer = typename dynarray_type::pointer;
+  using const_pointer = typename dynarray_type::const_pointer;
+  using iterator = typename dynarray_type::iterator;
+  using const_iterator = typename dynarray_type::const_iterator;
+  using reverse_iterator = typename dynarray_type::reverse_iterator;
+  using const_reverse_iterator = typename dynarray_type::const_reverse_iterator;
+
+  /**************************************************************************************************************************************/
+  /**                                                           construction                                                           **/
+  /**************************************************************************************************************************************/
+  static_dynarray() : static_dynarray(allocator_type()) {}
+  explicit static_dynarray(const allocator_type& alloc) : arr_(Extent, value_init, alloc) {}
+  explicit static_dynarray(value_init_t, const allocator_type& alloc = allocator_type()) : arr_(Extent, value_init, alloc) {}
+  explicit static_dynarray(for_overwrite_t, const allocator_type& alloc = allocator_type()) : arr_(Extent, for_overwrite, alloc) {}
+  explicit static_dynarray(const value_type& init, const allocator_type& alloc = allocator_type()) : arr_(Extent, init, alloc) {}
+  template <typename ForwardIt, typename std::enable_if<std::is_convertible<typename std::iterator_traits<ForwardIt>::iterator_category,
+                                                                            std::forward_iterator_tag>::value,
+                                                        bool>::type = true>
+  static_dynarray(ForwardIt first, ForwardIt last, const allocator_type& alloc = allocator_type())
+      : arr_(checked_extent(std::distance(first, last)) ? dynarray_type(first, last, alloc) : dynarray_type(alloc)) {}
+  static_dynarray(std::initializer_list<value_type> ilist, const allocator_type& alloc = allocator_type())
+      : static_dynarray(ilist.begin(), ilist.end(), alloc) {}
+  // a dynarray is only convertible if its size matches the extent (otherwise std::length_error is thrown)
+  explicit static_dynarray(const dynarray_type& other) : arr_(checked(other)) {}
+  explicit static_dynarray(dynarray_type&& other) : arr_(std::move(checked(other))) {}
+  static_dynarray(const static_dynarray&) = default;
+  static_dynarray(static_dynarray&& other) noexcept = default;
+
+  /**************************************************************************************************************************************/
+  /**                                                            assignment                                                            **/
+  /**************************************************************************************************************************************/
+  static_dynarray& operator=(const static_dynarray&) = default;
+  static_dynarray& operator=(static_dynarray&& rhs) noexcept(std::is_nothrow_move_assignable<dynarray_type>::value) {
+    if (this != &rhs) {
+      if (arr_.get_allocator() == rhs.arr_.get_allocator()) {
+        // exchange the buffers, rhs keeps our old one
+        arr_.swap(rhs.arr_);
+      } else {
+        // our allocator can't release the memory of rhs -> let the cpp_util::dynarray move the elements one by one
+        arr_ = std::move(rhs.arr_);
+      }
+    }
+    return *this;
+  }
+
+  DYNARRAY_NODISCARD allocator_type get_allocator() const noexcept { return arr_.get_allocator(); }
+
+  // convert to a cpp_util::dynarray by copying or moving the buffer
+  operator dynarray_type() const& { return arr_; }
+  operator dynarray_type() && noexcept { return std::move(arr_); }
+#if defined(__cpp_lib_span)
+  // a std::span with the same static extent
+  operator std::span<value_type, Extent>() noexcept { return std::span<value_type, Extent>{ this->buffer(), Extent }; }
+  operator std::span<const value_type, Extent>() const noexcept { return std::span<const value_type, Extent>{ this->buffer(), Extent }; }
+#endif
+
+  /**************************************************************************************************************************************/
+  /**                                                          element access                                                          **/
+  /**************************************************************************************************************************************/
+  DYNARRAY_NODISCARD reference at(const size_type pos) {
+    if (pos >= Extent) throw std::out_of_range{ "Index out-of-range: pos >= this->size()" };
+    return this->buffer()[pos];
+  }
+  DYNARRAY_NODISCARD const_reference at(const size_type pos) const {
+    if (pos >= Extent) throw std::out_of_range{ "Index out-of-range: pos >= this->size()" };
+    return this->buffer()[pos];
+  }
+  DYNARRAY_NODISCARD reference operator[](const size_type pos) {
+    assert((pos < Extent) && "Undefined behavior if pos >= this->size()!");
+    return this->buffer()[pos];
+  }
+  DYNARRAY_NODISCARD const_reference operator[](const size_type pos) const {
+    assert((pos < Extent) && "Undefined behavior if pos >= this->size()!");
+    return this->buffer()[pos];
+  }
+  DYNARRAY_NODISCARD reference front() { return (*this)[0]; }
+  DYNARRAY_NODISCARD const_reference front() const { return (*this)[0]; }
+  DYNARRAY_NODISCARD reference back() { return (*this)[Extent - 1]; }
+  DYNARRAY_NODISCARD const_reference back() const { return (*this)[Extent - 1]; }
+  DYNARRAY_NODISCARD pointer data() noexcept { return this->buffer(); }
+  DYNARRAY_NODISCARD const_pointer data() const noexcept { return this->buffer(); }
+
+  /**************************************************************************************************************************************/
+  /**                                                         iterator support                                                         **/
+  /**************************************************************************************************************************************/
+  DYNARRAY_NODISCARD iterator begin() noexcept { return this->buffer(); }
+  DYNARRAY_NODISCARD const_iterator begin() const noexcept { return this->buffer(); }
+  DYNARRAY_NODISCARD const_iterator cbegin() const noexcept { return this->buffer(); }
+  DYNARRAY_NODISCARD iterator end() noexcept { return this->buffer() + Extent; }
+  DYNARRAY_NODISCARD const_iterator end() const noexcept { return this->buffer() + Extent; }
+  DYNARRAY_NODISCARD const_iterator cend() const noexcept { return this->buffer() + Extent; }
+  DYNARRAY_NODISCARD reverse_iterator rbegin() noexcept { return detail::make_reverse_iterator(this->end()); }
+  DYNARRAY_NODISCARD const_reverse_iterator rbegin() const noexcept { return detail::make_reverse_iterator(this->end()); }
+  DYNARRAY_NODISCARD const_reverse_iterator crbegin() const noexcept { return detail::make_reverse_iterator(this->cend()); }
+  DYNARRAY_NODISCARD reverse_iterator rend() noexcept { return detail::make_reverse_iterator(this->begin()); }
+  DYNARRAY_NODISCARD const_reverse_iterator rend() const noexcept { return detail::make_reverse_iterator(this->begin()); }
+  DYNARRAY_NODISCARD const_reverse_iterator crend() const noexcept { return detail::make_reverse_iterator(this->cbegin()); }
+
+  /**************************************************************************************************************************************/
+  /**                                                             capacity                                                             **/
+  /**************************************************************************************************************************************/
+  DYNARRAY_NODISCARD static constexpr bool empty() noexcept { return Extent == 0; }
+  DYNARRAY_NODISCARD static constexpr size_type size() noexcept { return Extent; }
+  DYNARRAY_NODISCARD static constexpr size_type max_size() noexcept { return Extent; }
+
+  /**************************************************************************************************************************************/
+  /**                                                            operations                                                            **/
+  /**************************************************************************************************************************************/
+  void swap(static_dynarray& other) noexcept { arr_.swap(other.arr_); }
+  void fill(const value_type& value = value_type{}) { std::fill_n(this->buffer(), Extent, value); }
+  void iota(const value_type& value = value_type{}) { std::iota(this->begin(), this->end(), value); }
+  template <typename Generator>
+  void generate(Generator gen) {
+    std::generate_n(this->buffer(), Extent, gen);
+  }
+  void fill(const parallel_policy& policy, const value_type& value = value_type{}) {
+    assert(arr_.size() == Extent);
+    arr_.fill(policy, value);
+  }
+  void iota(const parallel_policy& policy, const value_type& value = value_type{}) {
+    assert(arr_.size() == Extent);
+    arr_.iota(policy, value);
+  }
+  template <typename Generator>
+  void generate(const parallel_policy& policy, Generator gen) {
+    assert(arr_.size() == Extent);
+    arr_.generate(policy, gen);
+  }
+
+  /**************************************************************************************************************************************/
+  /**                                                       non-member functions                                                       **/
+  /**************************************************************************************************************************************/
+  // both arrays have the same (compile-time) size
+#if defined(__cpp_impl_three_way_comparison) && defined(__cpp_lib_three_way_comparison)
+  DYNARRAY_NODISCARD friend bool operator==(const static_dynarray& lhs, const static_dynarray& rhs) noexcept {
+    return detail::equal_elements(lhs.data(), rhs.data(), Extent, detail::is_bitwise_comparable<T>{});
+  }
+  DYNARRAY_NODISCARD friend std::strong_ordering operator<=>(const static_dynarray& lhs, const static_dynarray& rhs) noexcept {
+    return detail::lexicographical_compare_three_way(lhs.data(), Extent, rhs.data(), Extent, detail::is_bitwise_comparable<T>{});
+  }
+#else
+  DYNARRAY_NODISCARD friend bool operator==(const static_dynarray& lhs, const static_dynarray& rhs) noexcept {
+    return detail::equal_elements(lhs.data(), rhs.data(), Extent, detail::is_bitwise_comparable<T>{});
+  }
+  DYNARRAY_NODISCARD friend bool operator!=(const static_dynarray& lhs, const static_dynarray& rhs) noexcept { return !(lhs == rhs); }
+  DYNARRAY_NODISCARD friend bool operator<(const static_dynarray& lhs, const static_dynarray& rhs) noexcept {
+    return detail::lexicographical_less(lhs.data(), Extent, rhs.data(), Extent, detail::is_bitwise_comparable<T>{});
+  }
+  DYNARRAY_NODISCARD friend bool operator>(const static_dynarray& lhs, const static_dynarray& rhs) noexcept { return rhs < lhs; }
+  DYNARRAY_NODISCARD friend bool operator<=(const static_dynarray& lhs, const static_dynarray& rhs) noexcept { return !(rhs < lhs); }
+  DYNARRAY_NODISCARD friend bool operator>=(const static_dynarray& lhs, const static_dynarray& rhs) noexcept { return !(lhs < rhs); }
+#endif
+
+ private:
+  // the buffer of Extent elements (a moved-from cpp_util::static_dynarray doesn't own one)
+  pointer buffer() noexcept {
+    assert((Extent == 0 || arr_.data() != nullptr) && "Undefined behavior if the cpp_util::static_dynarray has been moved from!");
+    return arr_.data();
+  }
+  const_pointer buffer() const noexcept {
+    assert((Extent == 0 || arr_.data() != nullptr) && "Undefined behavior if the cpp_util::static_dynarray has been moved from!");
+    return arr_.data();
+  }
+
+  static bool checked_extent(const difference_type size) {
+    if (size < 0 || static_cast<size_type>(size) != Extent) {
+      throw std::length_error{ "Size doesn't match the extent of the cpp_util::static_dynarray" };
+    }
+    return true;
+  }
+  template <typename Array>
+  static Array& checked(Array& arr) {
+    if (arr.size() != Extent) {
+      throw std::length_error{ "Size doesn't match the extent of the cpp_util::static_dynarray" };
+    }
+    return arr;
+  }
+
+  dynarray_type arr_;
+};
+
+template <typename T, std::size_t Extent, typename Allocator>
+void swap(static_dynarray<T, Extent, Allocator>& lhs, static_dynarray<T, Extent, Allocator>& rhs) noexcept {
+  lhs.swap(rhs);
+}
+
+}  // namespace cpp_util
+
+#endif  // CPP_UTIL_STATIC_DYNARRAY_HPP
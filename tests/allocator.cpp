@@ -0,0 +1,304 @@
+/**
+ * Copyright (C) 2021 - Marcel Breyer - All Rights Reserved
+ * Licensed under the MIT License. See LICENSE.md file in the project root for full license information.
+ *
+ * Implements tests for the allocator support of the cpp_util::dynarray class.
+ */
+
+#include "dynarray.hpp"
+
+#include "catch/catch.hpp"
+
+#include <algorithm>    // std::all_of
+#include <cstddef>      // std::size_t
+#include <cstdint>      // std::uintptr_t
+#include <cstdlib>      // std::malloc
+#include <memory>       // std::allocator, std::unique_ptr
+#include <new>          // placement new
+#include <numeric>      // std::iota
+#include <string>       // std::string
+#include <type_traits>  // std::integral_constant, std::is_same
+#include <utility>      // std::move, std::forward
+
+namespace {
+
+// stateful allocator counting its (de)allocations with configurable propagation traits
+template <typename T, bool Propagate>
+struct tracking_allocator {
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::integral_constant<bool, Propagate>;
+    using propagate_on_container_move_assignment = std::integral_constant<bool, Propagate>;
+    using propagate_on_container_swap = std::integral_constant<bool, Propagate>;
+
+    template <typename U>
+    struct rebind {
+        using other = tracking_allocator<U, Propagate>;
+    };
+
+    explicit tracking_allocator(const int id = 0, int* live = nullptr) : id{ id }, live{ live } {}
+    template <typename U>
+    tracking_allocator(const tracking_allocator<U, Propagate>& other) : id{ other.id }, live{ other.live } {}
+
+    T* allocate(const std::size_t n) {
+        if (live != nullptr) ++*live;
+        return std::allocator<T>{}.allocate(n);
+    }
+    void deallocate(T* ptr, const std::size_t n) {
+        if (live != nullptr) --*live;
+        std::allocator<T>{}.deallocate(ptr, n);
+    }
+
+    tracking_allocator select_on_container_copy_construction() const { return tracking_allocator{ id + 100, live }; }
+
+    friend bool operator==(const tracking_allocator& lhs, const tracking_allocator& rhs) { return lhs.id == rhs.id; }
+    friend bool operator!=(const tracking_allocator& lhs, const tracking_allocator& rhs) { return !(lhs == rhs); }
+
+    int id;
+    int* live;
+};
+
+// stateless allocator counting the calls to construct
+template <typename T>
+struct constructing_allocator : std::allocator<T> {
+    template <typename U>
+    struct rebind {
+        using other = constructing_allocator<U>;
+    };
+
+    constructing_allocator() = default;
+    template <typename U>
+    constructing_allocator(const constructing_allocator<U>&) {}
+
+    template <typename U, typename... Args>
+    void construct(U* ptr, Args&&... args) {
+        ++constructions;
+        ::new (static_cast<void*>(ptr)) U(std::forward<Args>(args)...);
+    }
+
+    static int constructions;
+};
+template <typename T>
+int constructing_allocator<T>::constructions = 0;
+
+}  // namespace
+
+TEST_CASE("dynarray allocator support", "[allocator]") {
+    using propagating_allocator = tracking_allocator<int, true>;
+    using non_propagating_allocator = tracking_allocator<int, false>;
+
+    int live = 0;
+
+    SECTION("member type and get_allocator()") {
+        CHECK(std::is_same<typename cpp_util::dynarray<int>::allocator_type, std::allocator<int>>::value);
+
+        const cpp_util::dynarray<int, propagating_allocator> arr(10, 42, propagating_allocator{ 1, &live });
+        CHECK(arr.get_allocator().id == 1);
+        CHECK(live == 1);
+    }
+
+    SECTION("stateless allocators don't increase the size") {
+        CHECK(sizeof(cpp_util::dynarray<int>) == sizeof(std::size_t) + sizeof(int*));
+    }
+
+    SECTION("all memory is released") {
+        {
+            cpp_util::dynarray<std::string, tracking_allocator<std::string, true>> arr(10, "foo",
+                                                                                       tracking_allocator<std::string, true>{ 1, &live });
+            cpp_util::dynarray<std::string, tracking_allocator<std::string, true>> copy{ arr };
+            CHECK(live == 2);
+        }
+        CHECK(live == 0);
+    }
+
+    SECTION("allocators customizing construct") {
+        constructing_allocator<int>::constructions = 0;
+        const cpp_util::dynarray<int, constructing_allocator<int>> arr1(10, 42);
+        CHECK(constructing_allocator<int>::constructions == 10);
+
+        // the elements may not be copied using std::memcpy
+        const cpp_util::dynarray<int, constructing_allocator<int>> arr2{ arr1 };
+        CHECK(constructing_allocator<int>::constructions == 20);
+        CHECK(std::all_of(arr2.begin(), arr2.end(), [](const int i) { return i == 42; }));
+    }
+
+    SECTION("aligned allocator") {
+        const auto is_aligned = [](const void* ptr, const std::size_t alignment) {
+            return reinterpret_cast<std::uintptr_t>(ptr) % alignment == 0;
+        };
+
+        const cpp_util::aligned_dynarray<float> arr1(13, 42.0f);
+        CHECK(is_aligned(arr1.data(), 64));
+        const cpp_util::aligned_dynarray<float> arr2{ arr1 };
+        CHECK(is_aligned(arr2.data(), 64));
+        CHECK(arr1 == arr2);
+
+        const cpp_util::aligned_dynarray<char, 4096, true> arr3(10, 'a');
+        CHECK(is_aligned(arr3.data(), 4096));
+        REQUIRE(arr3.size() == 10);
+        CHECK(std::all_of(arr3.begin(), arr3.end(), [](const char c) { return c == 'a'; }));
+    }
+
+    SECTION("copy constructor") {
+        const cpp_util::dynarray<int, propagating_allocator> arr1(10, 42, propagating_allocator{ 1, &live });
+        const cpp_util::dynarray<int, propagating_allocator> arr2{ arr1 };
+        CHECK(arr2.get_allocator().id == 101);
+
+        const cpp_util::dynarray<int, propagating_allocator> arr3(arr1, propagating_allocator{ 2, &live });
+        CHECK(arr3.get_allocator().id == 2);
+        REQUIRE(arr3.size() == 10);
+        CHECK(std::all_of(arr3.begin(), arr3.end(), [](const int i) { return i == 42; }));
+    }
+
+    SECTION("move constructor") {
+        cpp_util::dynarray<int, propagating_allocator> arr1(10, 42, propagating_allocator{ 1, &live });
+        const int* data = arr1.data();
+
+        cpp_util::dynarray<int, propagating_allocator> arr2{ std::move(arr1) };
+        CHECK(arr2.get_allocator().id == 1);
+        CHECK(arr2.data() == data);
+
+        // equal allocator -> steal memory
+        cpp_util::dynarray<int, propagating_allocator> arr3(std::move(arr2), propagating_allocator{ 1, &live });
+        CHECK(arr3.data() == data);
+
+        // unequal allocator -> move elements one by one
+        cpp_util::dynarray<int, propagating_allocator> arr4(std::move(arr3), propagating_allocator{ 2, &live });
+        CHECK(arr4.get_allocator().id == 2);
+        CHECK(arr4.data() != data);
+        REQUIRE(arr4.size() == 10);
+        CHECK(std::all_of(arr4.begin(), arr4.end(), [](const int i) { return i == 42; }));
+    }
+
+    SECTION("copy-assignment operator") {
+        const cpp_util::dynarray<int, propagating_allocator> p_arr1(10, 42, propagating_allocator{ 1, &live });
+        cpp_util::dynarray<int, propagating_allocator> p_arr2(5, 0, propagating_allocator{ 2, &live });
+        p_arr2 = p_arr1;
+        CHECK(p_arr2.get_allocator().id == 1);
+        REQUIRE(p_arr2.size() == 10);
+        CHECK(std::all_of(p_arr2.begin(), p_arr2.end(), [](const int i) { return i == 42; }));
+
+        const cpp_util::dynarray<int, non_propagating_allocator> np_arr1(10, 42, non_propagating_allocator{ 1, &live });
+        cpp_util::dynarray<int, non_propagating_allocator> np_arr2(5, 0, non_propagating_allocator{ 2, &live });
+        np_arr2 = np_arr1;
+        CHECK(np_arr2.get_allocator().id == 2);
+        REQUIRE(np_arr2.size() == 10);
+        CHECK(std::all_of(np_arr2.begin(), np_arr2.end(), [](const int i) { return i == 42; }));
+    }
+
+    SECTION("move-assignment operator") {
+        cpp_util::dynarray<int, propagating_allocator> p_arr1(10, 42, propagating_allocator{ 1, &live });
+        cpp_util::dynarray<int, propagating_allocator> p_arr2(5, 0, propagating_allocator{ 2, &live });
+        const int* data = p_arr1.data();
+        p_arr2 = std::move(p_arr1);
+        CHECK(p_arr2.get_allocator().id == 1);
+        CHECK(p_arr2.data() == data);
+
+        cpp_util::dynarray<int, non_propagating_allocator> np_arr1(10, 42, non_propagating_allocator{ 1, &live });
+        cpp_util::dynarray<int, non_propagating_allocator> np_arr2(5, 0, non_propagating_allocator{ 2, &live });
+        data = np_arr1.data();
+        np_arr2 = std::move(np_arr1);
+        CHECK(np_arr2.get_allocator().id == 2);
+        CHECK(np_arr2.data() != data);
+        REQUIRE(np_arr2.size() == 10);
+        CHECK(std::all_of(np_arr2.begin(), np_arr2.end(), [](const int i) { return i == 42; }));
+    }
+
+    SECTION("swap() member function") {
+        cpp_util::dynarray<int, propagating_allocator> arr1(10, 1, propagating_allocator{ 1, &live });
+        cpp_util::dynarray<int, propagating_allocator> arr2(5, 2, propagating_allocator{ 2, &live });
+        arr1.swap(arr2);
+
+        CHECK(arr1.get_allocator().id == 2);
+        CHECK(arr1.size() == 5);
+        CHECK(arr2.get_allocator().id == 1);
+        CHECK(arr2.size() == 10);
+    }
+
+    CHECK(live == 0);
+}
+
+namespace {
+
+// deleter counting its invocations
+struct counting_deleter {
+    int* calls;
+
+    void operator()(std::string* ptr) const {
+        ++*calls;
+        delete[] ptr;
+    }
+};
+
+}  // namespace
+
+TEST_CASE("dynarray adopt and release", "[allocator]") {
+    SECTION("adopt a std::malloc'ed buffer") {
+        int* buffer = static_cast<int*>(std::malloc(4 * sizeof(int)));
+        REQUIRE(buffer != nullptr);
+        std::iota(buffer, buffer + 4, 0);
+
+        const auto arr = cpp_util::dynarray<int, cpp_util::malloc_allocator<int>>::adopt(buffer, 4);
+        CHECK(arr.data() == buffer);
+        REQUIRE(arr.size() == 4);
+        CHECK(arr[3] == 3);
+    }
+
+    SECTION("adopt the buffer of a std::unique_ptr<T[]>") {
+        using array_type = cpp_util::dynarray<std::string, cpp_util::deleter_allocator<std::string>>;
+        std::unique_ptr<std::string[]> ptr{ new std::string[3]{ "a", "b", "c" } };
+        const std::string* buffer = ptr.get();
+
+        array_type arr = array_type::adopt(ptr.release(), 3);
+        CHECK(arr.data() == buffer);
+        CHECK(arr[2] == "c");
+
+        // copies use their own memory
+        array_type copy{ arr };
+        CHECK(copy.data() != buffer);
+        CHECK(copy == arr);
+
+        // the adopted buffer is moved together with its allocator
+        array_type moved{ std::move(arr) };
+        CHECK(moved.data() == buffer);
+        arr = std::move(moved);
+        CHECK(arr.data() == buffer);
+        swap(arr, copy);
+        CHECK(copy.data() == buffer);
+    }
+
+    SECTION("adopt with a deleter") {
+        using array_type = cpp_util::dynarray<std::string, cpp_util::deleter_allocator<std::string, counting_deleter>>;
+        int calls = 0;
+        {
+            array_type arr = array_type::adopt(new std::string[2]{ "a", "b" }, 2, counting_deleter{ &calls });
+            CHECK(arr.get_allocator().get_deleter().calls == &calls);
+
+            // assigning a different number of elements releases the adopted buffer
+            arr = { "c", "d", "e" };
+            CHECK(calls == 1);
+            arr.assign(2, "f");
+
+            array_type other = array_type::adopt(new std::string[1]{ "g" }, 1, counting_deleter{ &calls });
+            arr = other;
+            CHECK(arr[0] == "g");
+            CHECK(calls == 1);
+        }
+        CHECK(calls == 2);
+    }
+
+    SECTION("release") {
+        cpp_util::dynarray<int, cpp_util::malloc_allocator<int>> arr(5, 42);
+        const int* data = arr.data();
+        const std::size_t size = arr.size();
+
+        int* ptr = arr.release();
+        CHECK(ptr == data);
+        CHECK(arr.empty());
+        CHECK(arr.data() == nullptr);
+
+        // hand the buffer back
+        auto adopted = decltype(arr)::adopt(ptr, size, arr.get_allocator());
+        REQUIRE(adopted.size() == 5);
+        CHECK(std::all_of(adopted.begin(), adopted.end(), [](const int i) { return i == 42; }));
+    }
+}
@@ -11,6 +11,7 @@
 
 #include <algorithm>  // std::equal, std::all_of
 #include <utility>    // std::move
+#include <vector>     // std::vector
 
 TEST_CASE("dynarray assignment operators", "[assignment]") {
     cpp_util::dynarray<int> arr1{};
@@ -92,4 +93,18 @@ TEST_CASE("dynarray assignment operators", "[assignment]") {
         REQUIRE(arr1.size() == 3);
         CHECK(std::all_of(arr1.begin(), arr1.end(), [](const int i) { return i == 404; }));
     }
+
+    SECTION("assign using contiguous ranges") {
+        const std::vector<int> vec = { 1, 2, 3 };
+        arr2.assign(vec.begin(), vec.end());
+        CHECK(std::equal(arr2.begin(), arr2.end(), vec.begin()));
+
+        const int raw[] = { 4, 5, 6 };
+        arr2.assign(raw, raw + 3);
+        CHECK(std::equal(arr2.begin(), arr2.end(), raw));
+
+        // assigning the own elements
+        arr2.assign(arr2.cbegin(), arr2.cend());
+        CHECK(std::equal(arr2.begin(), arr2.end(), raw));
+    }
 }
@@ -0,0 +1,160 @@
+/**
+ * Copyright (C) 2021 - Marcel Breyer - All Rights Reserved
+ * Licensed under the MIT License. See LICENSE.md file in the project root for full license information.
+ *
+ * Implements tests for the binary serialization and deserialization of the cpp_util::dynarray class.
+ */
+
+#include "binary_io.hpp"
+
+#include "catch/catch.hpp"
+
+#include <algorithm>  // std::reverse
+#include <cstddef>    // std::size_t
+#include <cstdint>    // std::uint8_t, std::uint32_t, std::uint64_t
+#include <cstdio>     // std::tmpfile, std::fclose, std::FILE
+#include <cstring>    // std::memcpy
+#include <memory>     // std::allocator
+#include <sstream>    // std::stringstream
+#include <stdexcept>  // std::runtime_error, std::length_error
+#include <string>     // std::string
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>  // ::lseek, ::fileno
+#endif
+
+namespace {
+
+struct point {
+    float x;
+    float y;
+};
+
+// reverses the byte order of the header fields and of all elements of type T (as written by a machine with the opposite byte order)
+template <typename T>
+std::string swap_byte_order(std::string data) {
+    const auto reverse = [&](const std::size_t offset, const std::size_t size) {
+        std::reverse(&data[offset], &data[offset] + size);
+    };
+    reverse(8, 4);
+    reverse(12, 4);
+    reverse(16, 8);
+    reverse(24, 8);
+    for (std::size_t offset = 64; offset < data.size(); offset += sizeof(T)) {
+        reverse(offset, sizeof(T));
+    }
+    // the checksum is computed over the elements as stored by the writer
+    const std::uint64_t checksum = cpp_util::detail::xxh64::hash(data.data() + 64, data.size() - 64);
+    std::memcpy(&data[32], &checksum, sizeof(checksum));
+    reverse(32, 8);
+    return data;
+}
+
+}  // namespace
+
+TEST_CASE("binary serialization", "[binary_io]") {
+    SECTION("round trip") {
+        cpp_util::dynarray<double> arr(1000);
+        arr.iota(0.5);
+
+        std::stringstream stream;
+        cpp_util::write_binary(stream, arr);
+        // a 64 byte header followed by the elements
+        CHECK(stream.str().size() == 64 + 1000 * sizeof(double));
+        CHECK(stream.str().compare(0, 8, "DYNARRAY") == 0);
+
+        const cpp_util::dynarray<double> read = cpp_util::read_binary<double>(stream);
+        CHECK(read == arr);
+    }
+
+    SECTION("empty dynarray") {
+        std::stringstream stream;
+        cpp_util::write_binary(stream, cpp_util::dynarray<int>{});
+        CHECK(cpp_util::read_binary<int>(stream).empty());
+    }
+
+    SECTION("trivially copyable structs") {
+        const cpp_util::dynarray<point> arr = { { 1.0f, 2.0f }, { 3.0f, 4.0f } };
+        std::stringstream stream;
+        cpp_util::write_binary(stream, arr);
+
+        const auto read = cpp_util::read_binary<point, cpp_util::malloc_allocator<point>>(stream);
+        REQUIRE(read.size() == 2);
+        CHECK(read[1].x == 3.0f);
+        CHECK(read[1].y == 4.0f);
+    }
+
+    SECTION("multiple arrays in one stream") {
+        std::stringstream stream;
+        cpp_util::write_binary(stream, cpp_util::dynarray<int>{ 1, 2, 3 });
+        cpp_util::write_binary(stream, cpp_util::dynarray<char>{ 'a', 'b' });
+
+        CHECK(cpp_util::read_binary<int>(stream) == cpp_util::dynarray<int>{ 1, 2, 3 });
+        CHECK(cpp_util::read_binary<char>(stream) == cpp_util::dynarray<char>{ 'a', 'b' });
+    }
+
+    SECTION("opposite byte order") {
+        const cpp_util::dynarray<std::uint32_t> arr = { 0x01020304u, 0xAABBCCDDu };
+        std::stringstream stream;
+        cpp_util::write_binary(stream, arr);
+
+        std::stringstream swapped{ swap_byte_order<std::uint32_t>(stream.str()) };
+        CHECK(cpp_util::read_binary<std::uint32_t>(swapped) == arr);
+
+        // the byte order of non-arithmetic types can't be converted
+        const cpp_util::dynarray<point> points(3);
+        std::stringstream point_stream;
+        cpp_util::write_binary(point_stream, points);
+        std::stringstream swapped_points{ swap_byte_order<point>(point_stream.str()) };
+        CHECK_THROWS_AS(cpp_util::read_binary<point>(swapped_points), std::runtime_error);
+    }
+
+    SECTION("invalid data") {
+        const cpp_util::dynarray<std::uint64_t> arr(100, 42);
+        std::stringstream stream;
+        cpp_util::write_binary(stream, arr);
+        const std::string data = stream.str();
+
+        // element size mismatch
+        std::stringstream wrong_type{ data };
+        CHECK_THROWS_AS(cpp_util::read_binary<std::uint32_t>(wrong_type), std::runtime_error);
+
+        // corrupted payload
+        std::string corrupted_data = data;
+        corrupted_data[100] ^= 1;
+        std::stringstream corrupted{ corrupted_data };
+        CHECK_THROWS_AS(cpp_util::read_binary<std::uint64_t>(corrupted), std::runtime_error);
+
+        // truncated payload
+        std::stringstream truncated{ data.substr(0, data.size() - 1) };
+        CHECK_THROWS_AS(cpp_util::read_binary<std::uint64_t>(truncated), std::runtime_error);
+
+        // not a binary dynarray
+        std::stringstream garbage{ std::string(128, 'x') };
+        CHECK_THROWS_AS(cpp_util::read_binary<std::uint64_t>(garbage), std::runtime_error);
+
+        // the number of elements doesn't fit into the size_type
+        const cpp_util::dynarray<std::uint8_t> large(300);
+        std::stringstream large_stream;
+        cpp_util::write_binary(large_stream, large);
+        CHECK_THROWS_AS((cpp_util::read_binary<std::uint8_t, std::allocator<std::uint8_t>, std::uint8_t>(large_stream)), std::length_error);
+    }
+
+#if defined(__unix__) || defined(__APPLE__)
+    SECTION("file descriptor") {
+        std::FILE* file = std::tmpfile();
+        REQUIRE(file != nullptr);
+        const int fd = ::fileno(file);
+
+        cpp_util::dynarray<float> arr(1 << 16);
+        arr.iota();
+        cpp_util::write_binary(fd, arr);
+        REQUIRE(::lseek(fd, 0, SEEK_SET) == 0);
+        CHECK(cpp_util::read_binary<float>(fd) == arr);
+
+        // no more data
+        CHECK_THROWS_AS(cpp_util::read_binary<float>(fd), std::runtime_error);
+        std::fclose(file);
+    }
+#endif
+}
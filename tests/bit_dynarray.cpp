@@ -0,0 +1,210 @@
+/**
+ * Copyright (C) 2021 - Marcel Breyer - All Rights Reserved
+ * Licensed under the MIT License. See LICENSE.md file in the project root for full license information.
+ *
+ * Implements tests for the cpp_util::bit_dynarray class.
+ */
+
+#include "bit_dynarray.hpp"
+
+#include "catch/catch.hpp"
+
+#include <cstddef>      // std::size_t
+#include <cstdint>      // std::uint64_t
+#include <memory>       // std::allocator
+#include <stdexcept>    // std::out_of_range
+#include <type_traits>  // std::is_nothrow_move_assignable
+#include <utility>      // std::move
+#include <vector>       // std::vector
+
+namespace {
+
+// stateful allocator that neither propagates nor compares equal to allocators with another id
+template <typename T>
+struct stateful_allocator {
+    using value_type = T;
+
+    explicit stateful_allocator(const int id_ = 0) noexcept : id{ id_ } {}
+    template <typename U>
+    stateful_allocator(const stateful_allocator<U>& other) noexcept : id{ other.id } {}
+
+    T* allocate(const std::size_t n) { return std::allocator<T>{}.allocate(n); }
+    void deallocate(T* ptr, const std::size_t n) noexcept { std::allocator<T>{}.deallocate(ptr, n); }
+
+    friend bool operator==(const stateful_allocator& lhs, const stateful_allocator& rhs) noexcept { return lhs.id == rhs.id; }
+    friend bool operator!=(const stateful_allocator& lhs, const stateful_allocator& rhs) noexcept { return !(lhs == rhs); }
+
+    int id;
+};
+
+}  // namespace
+
+TEST_CASE("bit_dynarray construction", "[bit_dynarray]") {
+    SECTION("default constructor") {
+        const cpp_util::bit_dynarray<> arr;
+        CHECK(arr.empty());
+        CHECK(arr.num_words() == 0);
+        CHECK(arr.count() == 0);
+        CHECK(arr.find_first() == 0);
+        CHECK(arr.none());
+        CHECK(arr.all());
+    }
+
+    SECTION("one bit per element") {
+        const cpp_util::bit_dynarray<> arr(1000);
+        CHECK(arr.size() == 1000);
+        CHECK(arr.num_words() == 16);
+        CHECK(arr.none());
+    }
+
+    SECTION("value constructor") {
+        const cpp_util::bit_dynarray<> arr(100, true);
+        CHECK(arr.count() == 100);
+        CHECK(arr.all());
+        // the unused bits of the last word are zero
+        CHECK(arr.words()[1] == (std::uint64_t{ 1 } << 36) - 1);
+
+        const cpp_util::bit_dynarray<> overwrite(70, cpp_util::for_overwrite);
+        CHECK(overwrite.words()[1] >> 6 == 0);
+    }
+
+    SECTION("initializer_list constructor") {
+        const cpp_util::bit_dynarray<> arr{ true, false, true, true };
+        REQUIRE(arr.size() == 4);
+        CHECK(arr[0]);
+        CHECK_FALSE(arr[1]);
+        CHECK(arr.count() == 3);
+    }
+}
+
+TEST_CASE("bit_dynarray copy, move, and swap", "[bit_dynarray]") {
+    cpp_util::bit_dynarray<> arr{ true, false, true };
+
+    const cpp_util::bit_dynarray<> copy{ arr };
+    CHECK(copy == arr);
+
+    cpp_util::bit_dynarray<> moved{ std::move(arr) };
+    CHECK(moved == copy);
+    CHECK(arr.empty());
+
+    cpp_util::bit_dynarray<> other(10, true);
+    swap(moved, other);
+    CHECK(moved.size() == 10);
+    CHECK(other == copy);
+    other = moved;
+    CHECK(other.count() == 10);
+}
+
+TEST_CASE("bit_dynarray move assignment with unequal allocators", "[bit_dynarray]") {
+    using array_type = cpp_util::bit_dynarray<stateful_allocator<std::uint64_t>>;
+    // the words may have to be reallocated -> move assignment may throw
+    CHECK_FALSE(std::is_nothrow_move_assignable<array_type>::value);
+    CHECK(std::is_nothrow_move_assignable<cpp_util::bit_dynarray<>>::value);
+
+    array_type arr({ true, false, true }, stateful_allocator<std::uint64_t>{ 1 });
+    array_type other(70, false, stateful_allocator<std::uint64_t>{ 2 });
+    other = std::move(arr);
+    CHECK(other.size() == 3);
+    CHECK(other.test(0));
+    CHECK_FALSE(other.test(1));
+    CHECK(other.get_allocator().id == 2);
+    // arr still owns its words, so it must still report its size
+    CHECK(arr.size() == 3);
+    CHECK(arr.count() == 2);
+}
+
+TEST_CASE("bit_dynarray element access", "[bit_dynarray]") {
+    cpp_util::bit_dynarray<> arr(130);
+
+    arr[1] = true;
+    arr.set(64);
+    arr.set(129, true);
+    CHECK(arr.test(1));
+    CHECK(arr[64]);
+    CHECK(arr.at(129));
+    CHECK_THROWS_AS(arr.at(130), std::out_of_range);
+    CHECK(arr.count() == 3);
+
+    arr.reset(64);
+    arr.flip(2);
+    arr[3] = arr[1];
+    arr[1].flip();
+    CHECK_FALSE(arr[1]);
+    CHECK(arr[2]);
+    CHECK(arr[3]);
+    CHECK(arr.words()[0] == 0xC);
+}
+
+TEST_CASE("bit_dynarray operations", "[bit_dynarray]") {
+    cpp_util::bit_dynarray<> arr(200);
+
+    SECTION("fill") {
+        arr.fill(true);
+        CHECK(arr.all());
+        arr.flip();
+        CHECK(arr.none());
+        arr.set();
+        CHECK(arr.count() == 200);
+        arr.reset();
+        CHECK(arr.count() == 0);
+        arr.fill(cpp_util::par, true);
+        CHECK(arr.count() == 200);
+        arr = ~arr;
+        CHECK(arr.none());
+    }
+
+    SECTION("find") {
+        CHECK(arr.find_first() == 200);
+        arr.set(70);
+        arr.set(199);
+        CHECK(arr.find_first() == 70);
+        CHECK(arr.find_next(70) == 70);
+        CHECK(arr.find_next(71) == 199);
+        CHECK(arr.find_next(200) == 200);
+
+        arr.set();
+        CHECK(arr.find_first_unset() == 200);
+        arr.reset(3);
+        arr.reset(150);
+        CHECK(arr.find_first_unset() == 3);
+        CHECK(arr.find_next_unset(4) == 150);
+        CHECK(arr.find_next_unset(151) == 200);
+    }
+
+    SECTION("set bits") {
+        const std::vector<std::size_t> positions{ 0, 5, 63, 64, 128, 199 };
+        for (const std::size_t pos : positions) {
+            arr.set(pos);
+        }
+        std::vector<std::size_t> found;
+        for (const std::size_t pos : arr.set_bits()) {
+            found.push_back(pos);
+        }
+        CHECK(found == positions);
+
+        arr.reset();
+        CHECK(arr.set_bits().begin() == arr.set_bits().end());
+    }
+
+    SECTION("bitwise operators") {
+        cpp_util::bit_dynarray<> lhs(100);
+        cpp_util::bit_dynarray<> rhs(100);
+        lhs.set(1);
+        lhs.set(2);
+        rhs.set(2);
+        rhs.set(99);
+
+        CHECK((lhs & rhs).count() == 1);
+        CHECK((lhs | rhs).count() == 3);
+        CHECK((lhs ^ rhs).count() == 2);
+        CHECK((~lhs).count() == 98);
+
+        lhs |= rhs;
+        CHECK(lhs.find_next(3) == 99);
+        lhs ^= rhs;
+        CHECK(lhs.count() == 1);
+        lhs &= rhs;
+        CHECK(lhs.none());
+        CHECK(lhs != rhs);
+    }
+}
@@ -9,7 +9,11 @@
 
 #include "catch/catch.hpp"
 
-#include <limits>  // std::numeric_limits::max
+#include <algorithm>  // std::min
+#include <cstddef>    // std::size_t, std::ptrdiff_t
+#include <cstdint>    // std::uint8_t, std::uint32_t, std::uint64_t
+#include <limits>     // std::numeric_limits::max
+#include <memory>     // std::allocator
 
 TEST_CASE("dynarray capacity member functions", "[capacity]") {
     const cpp_util::dynarray<int> default_arr{};
@@ -27,5 +31,11 @@ TEST_CASE("dynarray capacity member functions", "[capacity]") {
 
     SECTION("max_size() member function") {
         CHECK(cpp_util::dynarray<int>::max_size() == (std::numeric_limits<std::ptrdiff_t>::max() / sizeof(int)));
+        // limited by the size_type
+        CHECK(cpp_util::dynarray<int, std::allocator<int>, std::uint8_t>::max_size() == 255);
+        CHECK(cpp_util::dynarray<int, std::allocator<int>, std::uint32_t>::max_size() ==
+              (std::min)(std::size_t{ std::numeric_limits<std::uint32_t>::max() }, std::numeric_limits<std::ptrdiff_t>::max() / sizeof(int)));
+        CHECK(cpp_util::dynarray<int, std::allocator<int>, std::uint64_t>::max_size() ==
+              static_cast<std::uint64_t>(std::numeric_limits<std::ptrdiff_t>::max() / sizeof(int)));
     }
 }
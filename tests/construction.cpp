@@ -9,9 +9,48 @@
 
 #include "catch/catch.hpp"
 
-#include <algorithm>  // std::all_of, std::equal
-#include <utility>    // std::move
-#include <vector>     // std::vector
+#include <algorithm>    // std::all_of, std::equal
+#include <array>        // std::array
+#include <cstddef>      // std::size_t
+#include <cstdint>      // std::uint8_t
+#include <memory>       // std::allocator
+#include <stdexcept>    // std::runtime_error, std::length_error
+#include <string>       // std::string
+#include <type_traits>  // std::is_convertible, std::is_constructible
+#include <utility>      // std::move
+#include <vector>       // std::vector
+
+namespace {
+
+// counts the constructions and live instances, throws on the n-th copy construction if requested
+struct counting_type {
+    static int default_constructions;
+    static int copy_constructions;
+    static int live;
+    static int throw_on_copy;
+
+    counting_type() {
+        ++default_constructions;
+        ++live;
+    }
+    counting_type(const counting_type&) {
+        if (throw_on_copy != 0 && copy_constructions + 1 == throw_on_copy) {
+            throw std::runtime_error{ "copy construction failed" };
+        }
+        ++copy_constructions;
+        ++live;
+    }
+    counting_type& operator=(const counting_type&) = default;
+    ~counting_type() { --live; }
+
+    static void reset() { default_constructions = copy_constructions = live = throw_on_copy = 0; }
+};
+int counting_type::default_constructions = 0;
+int counting_type::copy_constructions = 0;
+int counting_type::live = 0;
+int counting_type::throw_on_copy = 0;
+
+}  // namespace
 
 TEST_CASE("dynarray constructors", "[construction]") {
     SECTION("default constructor") {
@@ -27,6 +66,40 @@ TEST_CASE("dynarray constructors", "[construction]") {
         CHECK(arr.size() == 10);
     }
 
+    SECTION("size + value_init constructor") {
+        const cpp_util::dynarray<int> arr(10, cpp_util::value_init);
+
+        REQUIRE(arr.size() == 10);
+        CHECK(std::all_of(arr.begin(), arr.end(), [](const int i) { return i == 0; }));
+
+        // zeroed memory provided by calloc
+        const cpp_util::dynarray<double, cpp_util::malloc_allocator<double>> malloc_arr(10, cpp_util::value_init);
+
+        REQUIRE(malloc_arr.size() == 10);
+        CHECK(std::all_of(malloc_arr.begin(), malloc_arr.end(), [](const double d) { return d == 0.0; }));
+    }
+
+    SECTION("size + for_overwrite constructor") {
+        cpp_util::dynarray<float> arr(10, cpp_util::for_overwrite);
+
+        REQUIRE(arr.size() == 10);
+        arr.fill(42.0f);
+        CHECK(std::all_of(arr.begin(), arr.end(), [](const float f) { return f == 42.0f; }));
+
+        // non-trivial types are still default constructed
+        const cpp_util::dynarray<std::string> str_arr(10, cpp_util::for_overwrite);
+
+        REQUIRE(str_arr.size() == 10);
+        CHECK(std::all_of(str_arr.begin(), str_arr.end(), [](const std::string& str) { return str.empty(); }));
+
+        counting_type::reset();
+        {
+            const cpp_util::dynarray<counting_type> count_arr(10, cpp_util::for_overwrite);
+            CHECK(counting_type::default_constructions == 10);
+        }
+        CHECK(counting_type::live == 0);
+    }
+
     SECTION("size + init value constructor") {
         const cpp_util::dynarray<int> arr(10, 42);
 
@@ -47,6 +120,62 @@ TEST_CASE("dynarray constructors", "[construction]") {
 #endif
     }
 
+    SECTION("contiguous iterator range constructor") {
+        struct trivial_type {
+            int i;
+            double d;
+        };
+        const std::vector<trivial_type> vec = { { 1, 1.5 }, { 2, 2.5 }, { 3, 3.5 } };
+        const cpp_util::dynarray<trivial_type> arr1(vec.begin(), vec.end());
+        const cpp_util::dynarray<trivial_type> arr2(vec.data(), vec.data() + vec.size());
+
+        REQUIRE(arr1.size() == 3);
+        REQUIRE(arr2.size() == 3);
+        for (std::size_t i = 0; i < vec.size(); ++i) {
+            CHECK(arr1[i].i == vec[i].i);
+            CHECK(arr1[i].d == vec[i].d);
+            CHECK(arr2[i].i == vec[i].i);
+            CHECK(arr2[i].d == vec[i].d);
+        }
+    }
+
+    SECTION("contiguous range constructor") {
+        const std::vector<int> vec = { 1, 2, 3, 4 };
+        const cpp_util::dynarray<int> arr1(vec);
+        REQUIRE(arr1.size() == 4);
+        CHECK(std::equal(arr1.begin(), arr1.end(), vec.begin()));
+        CHECK(arr1.data() != vec.data());
+
+        const std::array<int, 3> std_arr = { { 5, 6, 7 } };
+        const cpp_util::dynarray<int> arr2(std_arr);
+        REQUIRE(arr2.size() == 3);
+        CHECK(std::equal(arr2.begin(), arr2.end(), std_arr.begin()));
+
+        const std::string str = "dynarray";
+        const cpp_util::dynarray<char> arr3(str);
+        CHECK(std::string(arr3.begin(), arr3.end()) == str);
+
+        // the range must be explicitly converted and its element type must match exactly
+        CHECK_FALSE((std::is_convertible<std::vector<int>, cpp_util::dynarray<int>>::value));
+        CHECK_FALSE((std::is_constructible<cpp_util::dynarray<long>, std::vector<int>>::value));
+        CHECK((std::is_constructible<cpp_util::dynarray<std::string>, std::vector<std::string>>::value));
+    }
+
+    SECTION("narrow size_type") {
+        using small_array = cpp_util::dynarray<int, std::allocator<int>, std::uint8_t>;
+        const std::vector<int> vec(255, 42);
+        const small_array arr(vec.begin(), vec.end());
+        REQUIRE(arr.size() == 255);
+        CHECK(std::all_of(arr.begin(), arr.end(), [](const int i) { return i == 42; }));
+
+        // the size of the range doesn't fit into the size_type
+        const std::vector<int> large_vec(256, 42);
+        CHECK_THROWS_AS(small_array(large_vec.begin(), large_vec.end()), std::length_error);
+        small_array assigned(3, 0);
+        CHECK_THROWS_AS(assigned.assign(large_vec.begin(), large_vec.end()), std::length_error);
+        CHECK(assigned.size() == 3);
+    }
+
     SECTION("initializer_list constructor") {
         const cpp_util::dynarray<int> arr = { 42, 42, 42 };
 
@@ -72,4 +201,33 @@ TEST_CASE("dynarray constructors", "[construction]") {
         REQUIRE(arr2.size() == 3);
         CHECK(std::all_of(arr2.begin(), arr2.end(), [](const int i) { return i == 42; }));
     }
+
+    SECTION("elements are constructed exactly once") {
+        counting_type::reset();
+        const counting_type init{};
+        const cpp_util::dynarray<counting_type> arr1(10, init);
+        CHECK(counting_type::default_constructions == 1);
+        CHECK(counting_type::copy_constructions == 10);
+
+        counting_type::reset();
+        const cpp_util::dynarray<counting_type> arr2(arr1);
+        CHECK(counting_type::default_constructions == 0);
+        CHECK(counting_type::copy_constructions == 10);
+    }
+
+    SECTION("construction is exception safe") {
+        counting_type::reset();
+        {
+            const counting_type init{};
+            counting_type::throw_on_copy = 5;
+            CHECK_THROWS_AS(cpp_util::dynarray<counting_type>(10, init), std::runtime_error);
+            CHECK(counting_type::live == 1);
+
+            const std::vector<counting_type> vec(10);
+            counting_type::copy_constructions = 0;
+            CHECK_THROWS_AS(cpp_util::dynarray<counting_type>(vec.begin(), vec.end()), std::runtime_error);
+            CHECK(counting_type::live == 11);
+        }
+        CHECK(counting_type::live == 0);
+    }
 }
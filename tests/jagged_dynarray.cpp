@@ -0,0 +1,156 @@
+/**
+ * Copyright (C) 2021 - Marcel Breyer - All Rights Reserved
+ * Licensed under the MIT License. See LICENSE.md file in the project root for full license information.
+ *
+ * Implements tests for the cpp_util::jagged_dynarray and cpp_util::row_view classes.
+ */
+
+#include "jagged_dynarray.hpp"
+
+#include "catch/catch.hpp"
+
+#include <algorithm>  // std::all_of, std::equal
+#include <cstddef>    // std::size_t
+#include <stdexcept>  // std::out_of_range
+#include <string>     // std::string
+#include <utility>    // std::move
+#include <vector>     // std::vector
+
+TEST_CASE("jagged_dynarray construction", "[jagged_dynarray]") {
+    SECTION("default constructor") {
+        const cpp_util::jagged_dynarray<int> arr;
+        CHECK(arr.empty());
+        CHECK(arr.size() == 0);
+        CHECK(arr.num_values() == 0);
+        CHECK(arr.begin() == arr.end());
+        REQUIRE(arr.offsets().size() == 1);
+        CHECK(arr.offsets()[0] == 0);
+    }
+
+    SECTION("row sizes") {
+        const std::vector<std::size_t> sizes{ 2, 0, 3, 1 };
+        const cpp_util::jagged_dynarray<int> arr(sizes.begin(), sizes.end());
+        REQUIRE(arr.size() == 4);
+        CHECK(arr.num_values() == 6);
+        CHECK(std::all_of(arr.values().begin(), arr.values().end(), [](const int i) { return i == 0; }));
+        for (std::size_t row = 0; row < sizes.size(); ++row) {
+            CHECK(arr.row_size(row) == sizes[row]);
+            CHECK(arr[row].size() == sizes[row]);
+        }
+        CHECK(arr.offsets() == cpp_util::dynarray<std::size_t>{ 0, 2, 2, 5, 6 });
+
+        const cpp_util::jagged_dynarray<std::string> strings(sizes.begin(), sizes.end(), "foo");
+        CHECK(std::all_of(strings.values().begin(), strings.values().end(), [](const std::string& str) { return str == "foo"; }));
+
+        const cpp_util::jagged_dynarray<std::string> overwrite(sizes.begin(), sizes.end(), cpp_util::for_overwrite);
+        CHECK(overwrite.num_values() == 6);
+    }
+
+    SECTION("nested initializer_list") {
+        const cpp_util::jagged_dynarray<int> arr{ {}, { 1, 2 }, {}, { 3 }, { 4, 5, 6 }, {} };
+        REQUIRE(arr.size() == 6);
+        CHECK(arr.values() == cpp_util::dynarray<int>{ 1, 2, 3, 4, 5, 6 });
+        CHECK(arr[0].empty());
+        CHECK(arr[1] == cpp_util::row_view<const int>{ arr.values().data(), 2 });
+        CHECK(arr[4].front() == 4);
+        CHECK(arr[4].back() == 6);
+        CHECK(arr[5].empty());
+    }
+
+    SECTION("values are contiguous") {
+        const cpp_util::jagged_dynarray<int> arr{ { 1 }, { 2, 3 }, { 4, 5, 6 } };
+        for (std::size_t row = 0; row < arr.size(); ++row) {
+            CHECK(arr[row].data() == arr.values().data() + arr.offsets()[row]);
+        }
+    }
+}
+
+TEST_CASE("jagged_dynarray copy, move, and swap", "[jagged_dynarray]") {
+    cpp_util::jagged_dynarray<std::string> arr{ { "a", "b" }, { "c" } };
+
+    SECTION("copy") {
+        const cpp_util::jagged_dynarray<std::string> copy{ arr };
+        CHECK(copy == arr);
+        CHECK(copy.values().data() != arr.values().data());
+    }
+
+    SECTION("move") {
+        const std::string* data = arr.values().data();
+        const cpp_util::jagged_dynarray<std::string> moved{ std::move(arr) };
+        CHECK(moved.values().data() == data);
+        CHECK(moved.size() == 2);
+        // the moved-from jagged_dynarray is empty and can still be iterated and compared
+        CHECK(arr.size() == 0);
+        CHECK(arr.empty());
+        CHECK(arr.begin() == arr.end());
+        CHECK(arr == cpp_util::jagged_dynarray<std::string>{});
+    }
+
+    SECTION("swap") {
+        cpp_util::jagged_dynarray<std::string> other{ { "x" }, { "y" }, { "z" } };
+        swap(arr, other);
+        CHECK(arr.size() == 3);
+        CHECK(other.size() == 2);
+        CHECK(other[0][1] == "b");
+        CHECK(arr != other);
+    }
+}
+
+TEST_CASE("jagged_dynarray element access", "[jagged_dynarray]") {
+    const std::vector<std::size_t> sizes{ 3, 1, 2 };
+    cpp_util::jagged_dynarray<int> arr(sizes.begin(), sizes.end());
+
+    CHECK_THROWS_AS(arr.at(3), std::out_of_range);
+    CHECK_THROWS_AS(arr.at(0).at(3), std::out_of_range);
+    arr.at(2).at(1) = 42;
+    CHECK(arr[2][1] == 42);
+    CHECK(arr.values().back() == 42);
+
+    const cpp_util::jagged_dynarray<int>& const_arr = arr;
+    const cpp_util::row_view<const int> row = const_arr[2];
+    CHECK(row.back() == 42);
+    CHECK(*row.rbegin() == 42);
+    // a row of modifiable values converts to a row of const values
+    const cpp_util::row_view<const int> converted = arr[2];
+    CHECK(converted == row);
+}
+
+TEST_CASE("jagged_dynarray operations", "[jagged_dynarray]") {
+    const std::vector<std::size_t> sizes{ 3, 0, 2 };
+    cpp_util::jagged_dynarray<int> arr(sizes.begin(), sizes.end());
+
+    SECTION("per row") {
+        arr[0].iota(1);
+        arr[1].fill(7);
+        int value = 10;
+        arr[2].generate([&]() { return value++; });
+        CHECK(arr.values() == cpp_util::dynarray<int>{ 1, 2, 3, 10, 11 });
+        arr[2].fill(-1);
+        CHECK(arr[0].back() == 3);
+        CHECK(arr[2].front() == -1);
+    }
+
+    SECTION("all values") {
+        arr.iota(0);
+        CHECK(arr[2].back() == 4);
+        arr.fill(cpp_util::par, 42);
+        CHECK(std::all_of(arr.values().begin(), arr.values().end(), [](const int i) { return i == 42; }));
+        arr.generate(cpp_util::par, [](const std::size_t pos) { return static_cast<int>(pos); });
+        CHECK(arr[2].front() == 3);
+    }
+
+    SECTION("row iteration") {
+        arr.iota(0);
+        std::vector<std::size_t> row_sizes;
+        int sum = 0;
+        for (const cpp_util::row_view<int> row : arr) {
+            row_sizes.push_back(row.size());
+            for (const int i : row) {
+                sum += i;
+            }
+        }
+        CHECK(row_sizes == sizes);
+        CHECK(sum == 10);
+        CHECK(std::equal(arr.cbegin(), arr.cend(), arr.begin()));
+    }
+}
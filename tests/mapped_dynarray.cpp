@@ -0,0 +1,224 @@
+/**
+ * Copyright (C) 2021 - Marcel Breyer - All Rights Reserved
+ * Licensed under the MIT License. See LICENSE.md file in the project root for full license information.
+ *
+ * Implements tests for the cpp_util::mapped_dynarray class.
+ */
+
+#include "mapped_dynarray.hpp"
+
+#include "catch/catch.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#include <algorithm>     // std::equal, std::all_of
+#include <cstddef>       // std::size_t
+#include <cstdint>       // std::uint32_t, std::uint64_t, std::uintptr_t
+#include <cstdio>        // std::remove
+#include <fstream>       // std::ofstream, std::ifstream
+#include <limits>        // std::numeric_limits
+#include <stdexcept>     // std::out_of_range, std::runtime_error, std::length_error
+#include <string>        // std::string
+#include <system_error>  // std::system_error
+#include <utility>       // std::move
+
+#include <stdlib.h>    // ::mkstemp
+#include <sys/stat.h>  // ::stat
+#include <unistd.h>    // ::close
+
+namespace {
+
+// a temporary file removed at the end of the test
+class temporary_file {
+ public:
+    // an empty file
+    temporary_file() {
+        const int fd = this->create();
+        ::close(fd);
+    }
+    template <typename T>
+    explicit temporary_file(const cpp_util::dynarray<T>& arr) {
+        const int fd = this->create();
+        cpp_util::write_binary(fd, arr);
+        ::close(fd);
+    }
+    temporary_file(const temporary_file&) = delete;
+    temporary_file& operator=(const temporary_file&) = delete;
+    ~temporary_file() { std::remove(path_.c_str()); }
+
+    const std::string& path() const noexcept { return path_; }
+
+ private:
+    int create() {
+        char name[] = "/tmp/cpp_util_mapped_dynarrayXXXXXX";
+        const int fd = ::mkstemp(name);
+        REQUIRE(fd >= 0);
+        path_ = name;
+        return fd;
+    }
+
+    std::string path_;
+};
+
+}  // namespace
+
+TEST_CASE("mapped_dynarray", "[mapped_dynarray]") {
+    cpp_util::dynarray<std::uint64_t> arr(10000);
+    arr.iota(42);
+    const temporary_file file{ arr };
+
+    SECTION("read API") {
+        const cpp_util::mapped_dynarray<const std::uint64_t> mapped{ file.path() };
+        REQUIRE(mapped.size() == arr.size());
+        CHECK_FALSE(mapped.empty());
+        CHECK(mapped[0] == 42);
+        CHECK(mapped.at(9999) == 10041);
+        CHECK_THROWS_AS(mapped.at(10000), std::out_of_range);
+        CHECK(mapped.front() == 42);
+        CHECK(mapped.back() == 10041);
+        CHECK(std::equal(mapped.begin(), mapped.end(), arr.begin()));
+        CHECK(*mapped.rbegin() == 10041);
+        CHECK(mapped.verify());
+        // the elements are aligned to a cache line
+        CHECK(reinterpret_cast<std::uintptr_t>(mapped.data()) % 64 == 0);
+    }
+
+    SECTION("prefetch") {
+        const cpp_util::mapped_dynarray<const std::uint64_t> populated{ file.path(), cpp_util::map_prefetch::populate };
+        const cpp_util::mapped_dynarray<const std::uint64_t> will_need{ file.path(), cpp_util::map_prefetch::will_need };
+        CHECK(populated == will_need);
+        CHECK_FALSE(populated != will_need);
+        CHECK(populated <= will_need);
+    }
+
+    SECTION("move and swap") {
+        cpp_util::mapped_dynarray<const std::uint64_t> mapped{ file.path() };
+        const std::uint64_t* data = mapped.data();
+
+        cpp_util::mapped_dynarray<const std::uint64_t> moved{ std::move(mapped) };
+        CHECK(moved.data() == data);
+        CHECK(mapped.empty());
+
+        mapped = std::move(moved);
+        CHECK(mapped.data() == data);
+        swap(mapped, moved);
+        CHECK(moved.size() == 10000);
+        CHECK(mapped.empty());
+    }
+
+    SECTION("empty dynarray") {
+        const temporary_file empty_file{ cpp_util::dynarray<float>{} };
+        const cpp_util::mapped_dynarray<const float> mapped{ empty_file.path() };
+        CHECK(mapped.empty());
+        CHECK(mapped.begin() == mapped.end());
+        CHECK(mapped.verify());
+    }
+
+    SECTION("invalid files") {
+        CHECK_THROWS_AS(cpp_util::mapped_dynarray<const std::uint64_t>{ file.path() + ".missing" }, std::system_error);
+        // element size mismatch
+        CHECK_THROWS_AS(cpp_util::mapped_dynarray<const std::uint32_t>{ file.path() }, std::runtime_error);
+
+        // corrupted elements are only detected by verify()
+        {
+            std::ofstream out{ file.path(), std::ios::binary | std::ios::in | std::ios::out | std::ios::ate };
+            out.seekp(-8, std::ios::end);
+            out.put('x');
+        }
+        const cpp_util::mapped_dynarray<const std::uint64_t> corrupted{ file.path() };
+        CHECK_FALSE(corrupted.verify());
+
+        // truncated file
+        std::ofstream{ file.path(), std::ios::binary | std::ios::trunc } << "DYNARRAY";
+        CHECK_THROWS_AS(cpp_util::mapped_dynarray<const std::uint64_t>{ file.path() }, std::runtime_error);
+    }
+}
+
+TEST_CASE("writable mapped_dynarray", "[mapped_dynarray]") {
+    const temporary_file file{};
+
+    SECTION("create, fill, and read back") {
+        {
+            cpp_util::mapped_dynarray<std::uint64_t> mapped{ file.path(), 10000 };
+            REQUIRE(mapped.size() == 10000);
+            // a new file is zero initialized
+            CHECK(std::all_of(mapped.begin(), mapped.end(), [](const std::uint64_t val) { return val == 0; }));
+            mapped.iota(42);
+            mapped[1] = 7;
+            mapped.back() = 1;
+            mapped.flush();
+        }
+        cpp_util::dynarray<std::uint64_t> expected(10000);
+        expected.iota(42);
+        expected[1] = 7;
+        expected.back() = 1;
+        std::ifstream in{ file.path(), std::ios::binary };
+        CHECK(cpp_util::read_binary<std::uint64_t>(in) == expected);
+
+        const cpp_util::mapped_dynarray<const std::uint64_t> view{ file.path() };
+        CHECK(view.verify());
+        CHECK(std::equal(view.begin(), view.end(), expected.begin()));
+    }
+
+    SECTION("reopen and modify") {
+        {
+            cpp_util::mapped_dynarray<int> mapped{ file.path(), 1 << 16 };
+            mapped.fill(cpp_util::par(4), 3);
+            mapped.flush();
+        }
+        {
+            cpp_util::mapped_dynarray<int> mapped{ file.path(), cpp_util::map_prefetch::populate };
+            REQUIRE(mapped.size() == 1 << 16);
+            CHECK(mapped.at(100) == 3);
+            CHECK_THROWS_AS(mapped.at(1 << 16), std::out_of_range);
+            mapped.generate(cpp_util::par, [](const std::size_t pos) { return static_cast<int>(pos % 7); });
+            mapped.flush();
+        }
+        std::ifstream in{ file.path(), std::ios::binary };
+        const cpp_util::dynarray<int> read = cpp_util::read_binary<int>(in);
+        REQUIRE(read.size() == 1 << 16);
+        CHECK(read[100] == 2);
+        CHECK(read.back() == ((1 << 16) - 1) % 7);
+
+        // the size of the elements must match
+        CHECK_THROWS_AS(cpp_util::mapped_dynarray<double>{ file.path() }, std::runtime_error);
+    }
+
+    SECTION("access hints and preallocation") {
+        cpp_util::mapped_dynarray<double> mapped{ file.path(), 1 << 20, true };
+        struct ::stat status {};
+        REQUIRE(::stat(file.path().c_str(), &status) == 0);
+        CHECK(static_cast<std::size_t>(status.st_size) == 64 + (1 << 20) * sizeof(double));
+
+        mapped.advise(cpp_util::map_advice::sequential);
+        mapped.iota(cpp_util::par, 0.0);
+        mapped.advise(cpp_util::map_advice::random);
+        CHECK(mapped[12345] == 12345.0);
+        mapped.advise(cpp_util::map_advice::dont_need);
+        // shared file pages survive MADV_DONTNEED
+        CHECK(mapped[12345] == 12345.0);
+        mapped.advise(cpp_util::map_advice::normal);
+    }
+
+    SECTION("move and swap") {
+        cpp_util::mapped_dynarray<char> mapped{ file.path(), 10 };
+        mapped.fill('a');
+        cpp_util::mapped_dynarray<char> moved{ std::move(mapped) };
+        CHECK(mapped.empty());
+        CHECK(moved.size() == 10);
+        swap(mapped, moved);
+        CHECK(mapped.front() == 'a');
+        CHECK(moved.empty());
+        // no-ops for an empty mapped_dynarray
+        moved.flush();
+        moved.advise(cpp_util::map_advice::will_need);
+        CHECK(moved < mapped);
+    }
+
+    SECTION("invalid sizes") {
+        CHECK_THROWS_AS((cpp_util::mapped_dynarray<std::uint64_t>{ file.path(), (std::numeric_limits<std::size_t>::max)() }), std::length_error);
+        CHECK_THROWS_AS((cpp_util::mapped_dynarray<int>{ file.path() + "/missing", 10 }), std::system_error);
+    }
+}
+
+#endif
@@ -0,0 +1,200 @@
+/**
+ * Copyright (C) 2021 - Marcel Breyer - All Rights Reserved
+ * Licensed under the MIT License. See LICENSE.md file in the project root for full license information.
+ *
+ * Implements tests for the cpp_util::md_dynarray and cpp_util::strided_view classes.
+ */
+
+#include "md_dynarray.hpp"
+
+#include "catch/catch.hpp"
+
+#include <algorithm>  // std::all_of, std::sort, std::unique
+#include <array>      // std::array
+#include <cstddef>    // std::size_t
+#include <stdexcept>  // std::out_of_range
+#include <utility>    // std::move
+#include <vector>     // std::vector
+
+namespace {
+
+using extents2 = std::array<std::size_t, 2>;
+using extents3 = std::array<std::size_t, 3>;
+
+// the mapping of all indices is a bijection into the buffer
+template <typename Array>
+bool is_bijective(const Array& arr) {
+    std::vector<std::size_t> offsets;
+    cpp_util::detail::for_each_index(arr.extents(), [&](const typename Array::extents_type& idx) { offsets.push_back(arr.mapping()(idx)); });
+    std::sort(offsets.begin(), offsets.end());
+    return offsets.size() == arr.size() && std::unique(offsets.begin(), offsets.end()) == offsets.end()
+           && (offsets.empty() || offsets.back() < arr.values().size());
+}
+
+}  // namespace
+
+TEMPLATE_TEST_CASE("md_dynarray layouts", "[md_dynarray]", cpp_util::layout_row_major, cpp_util::layout_column_major,
+                   cpp_util::layout_tiled<>, cpp_util::layout_tiled<4>) {
+    SECTION("default constructor") {
+        const cpp_util::md_dynarray<int, 2, TestType> arr;
+        CHECK(arr.empty());
+        CHECK(arr.size() == 0);
+        CHECK(arr.values().empty());
+    }
+
+    SECTION("extents") {
+        const cpp_util::md_dynarray<int, 3, TestType> arr(extents3{ { 3, 5, 7 } });
+        CHECK(arr.rank() == 3);
+        CHECK(arr.extent(0) == 3);
+        CHECK(arr.extent(2) == 7);
+        CHECK(arr.size() == 105);
+        CHECK(arr.values().size() >= arr.size());
+        CHECK(std::all_of(arr.values().begin(), arr.values().end(), [](const int i) { return i == 0; }));
+        CHECK(is_bijective(arr));
+    }
+
+    SECTION("element access") {
+        cpp_util::md_dynarray<int, 2, TestType> arr(extents2{ { 9, 11 } }, cpp_util::for_overwrite);
+        for (std::size_t i = 0; i < 9; ++i) {
+            for (std::size_t j = 0; j < 11; ++j) {
+                arr(i, j) = static_cast<int>(i * 100 + j);
+            }
+        }
+        CHECK(arr(0, 0) == 0);
+        CHECK(arr(8, 10) == 810);
+        CHECK(arr(extents2{ { 4, 5 } }) == 405);
+        CHECK(arr.at(3, 2) == 302);
+        CHECK_THROWS_AS(arr.at(9, 0), std::out_of_range);
+        CHECK_THROWS_AS(arr.at(0, 11), std::out_of_range);
+
+        // convert to other layouts
+        const cpp_util::md_dynarray<int, 2> row_major{ arr };
+        CHECK(row_major.values()[12] == 101);
+        const cpp_util::md_dynarray<int, 2, cpp_util::layout_column_major> column_major{ arr };
+        CHECK(column_major.values()[10] == 101);
+        CHECK(cpp_util::md_dynarray<int, 2, TestType>{ column_major } == arr);
+    }
+
+    SECTION("copy, move, and swap") {
+        cpp_util::md_dynarray<int, 2, TestType> arr(extents2{ { 3, 4 } }, 42);
+        const cpp_util::md_dynarray<int, 2, TestType> copy{ arr };
+        CHECK(copy == arr);
+        arr(1, 2) = 0;
+        CHECK(copy != arr);
+
+        const int* data = arr.data();
+        cpp_util::md_dynarray<int, 2, TestType> moved{ std::move(arr) };
+        CHECK(moved.data() == data);
+        // the moved-from md_dynarray is empty
+        CHECK(arr.size() == 0);
+        CHECK(arr.empty());
+        CHECK(arr.extents() == extents2{ { 0, 0 } });
+        CHECK(arr == cpp_util::md_dynarray<int, 2, TestType>{});
+        arr = std::move(moved);
+        CHECK(moved.empty());
+        moved = std::move(arr);
+        CHECK(moved.data() == data);
+        CHECK(arr.empty());
+
+        cpp_util::md_dynarray<int, 2, TestType> other(extents2{ { 1, 1 } });
+        swap(moved, other);
+        CHECK(moved.size() == 1);
+        CHECK(other.extents() == extents2{ { 3, 4 } });
+        CHECK(other(1, 2) == 0);
+
+        other.fill(cpp_util::par, 7);
+        CHECK(other(2, 3) == 7);
+    }
+}
+
+TEST_CASE("md_dynarray layout mappings", "[md_dynarray]") {
+    SECTION("row-major") {
+        const cpp_util::md_dynarray<int, 3> arr(extents3{ { 2, 3, 4 } });
+        CHECK(arr.mapping()(extents3{ { 0, 0, 1 } }) == 1);
+        CHECK(arr.mapping()(extents3{ { 0, 1, 0 } }) == 4);
+        CHECK(arr.mapping()(extents3{ { 1, 0, 0 } }) == 12);
+        CHECK(arr.values().size() == 24);
+    }
+
+    SECTION("column-major") {
+        const cpp_util::md_dynarray<int, 3, cpp_util::layout_column_major> arr(extents3{ { 2, 3, 4 } });
+        CHECK(arr.mapping()(extents3{ { 1, 0, 0 } }) == 1);
+        CHECK(arr.mapping()(extents3{ { 0, 1, 0 } }) == 2);
+        CHECK(arr.mapping()(extents3{ { 0, 0, 1 } }) == 6);
+    }
+
+    SECTION("tiled") {
+        using mapping_type = cpp_util::layout_tiled<4>::mapping<int, 2>;
+        const mapping_type mapping{ extents2{ { 6, 10 } } };
+        // padded to 8x12, i.e., 2x3 tiles of 16 elements
+        CHECK(mapping.required_span_size() == 96);
+        CHECK(mapping(extents2{ { 0, 3 } }) == 3);
+        CHECK(mapping(extents2{ { 1, 0 } }) == 4);
+        CHECK(mapping(extents2{ { 0, 4 } }) == 16);
+        CHECK(mapping(extents2{ { 4, 0 } }) == 48);
+
+        // the default tile fills half of the L1 cache
+        CHECK(cpp_util::layout_tiled<>::mapping<float, 2>::tile_extent() == 64);
+        CHECK(cpp_util::layout_tiled<>::mapping<double, 2>::tile_extent() == 32);
+        CHECK(cpp_util::layout_tiled<>::mapping<float, 3>::tile_extent() == 16);
+    }
+}
+
+TEST_CASE("md_dynarray strided views", "[md_dynarray]") {
+    cpp_util::md_dynarray<int, 3> arr(extents3{ { 2, 3, 4 } });
+    arr.values().iota(0);
+
+    SECTION("view") {
+        const cpp_util::strided_view<int, 3> view = arr.view();
+        CHECK(view.size() == 24);
+        CHECK(view.stride(0) == 12);
+        CHECK(view(1, 2, 3) == 23);
+        CHECK_THROWS_AS(view.at(2, 0, 0), std::out_of_range);
+        view(1, 2, 3) = -1;
+        CHECK(arr(1, 2, 3) == -1);
+    }
+
+    SECTION("slice") {
+        const cpp_util::strided_view<int, 2> first = arr.slice(0, 1);
+        CHECK(first.extents() == extents2{ { 3, 4 } });
+        CHECK(first(0, 0) == 12);
+        CHECK(first(2, 1) == 21);
+
+        const cpp_util::strided_view<int, 2> middle = arr.slice(1, 2);
+        CHECK(middle.extents() == extents2{ { 2, 4 } });
+        CHECK(middle(1, 3) == 23);
+
+        // a column of a slice
+        const cpp_util::strided_view<int, 1> column = middle.slice(1, 0);
+        CHECK(column.size() == 2);
+        CHECK(column(1) == 20);
+        column.fill(42);
+        CHECK(arr(0, 2, 0) == 42);
+        CHECK(arr(1, 2, 0) == 42);
+
+        const cpp_util::md_dynarray<int, 3>& const_arr = arr;
+        const cpp_util::strided_view<const int, 2> const_slice = const_arr.slice(2, 3);
+        CHECK(const_slice(1, 1) == 19);
+    }
+
+    SECTION("subview") {
+        const cpp_util::strided_view<int, 3> sub = arr.subview(extents3{ { 1, 1, 1 } }, extents3{ { 1, 2, 2 } });
+        CHECK(sub.size() == 4);
+        CHECK(sub(0, 0, 0) == 17);
+        CHECK(sub(0, 1, 1) == 22);
+        sub.fill(0);
+        CHECK(arr(1, 1, 1) == 0);
+        CHECK(arr(1, 2, 2) == 0);
+        CHECK(arr(1, 2, 3) == 23);
+        CHECK(arr(1, 1, 0) == 16);
+    }
+
+    SECTION("column-major view") {
+        cpp_util::md_dynarray<int, 2, cpp_util::layout_column_major> matrix(extents2{ { 3, 2 } });
+        matrix.values().iota(0);
+        const cpp_util::strided_view<int, 1> row = matrix.slice(0, 1);
+        CHECK(row.stride(0) == 3);
+        CHECK(row(0) == 1);
+        CHECK(row(1) == 4);
+    }
+}
@@ -0,0 +1,82 @@
+/**
+ * Copyright (C) 2021 - Marcel Breyer - All Rights Reserved
+ * Licensed under the MIT License. See LICENSE.md file in the project root for full license information.
+ *
+ * Implements tests for the cpp_util::mmap_allocator class.
+ */
+
+#include "mmap_allocator.hpp"
+
+#include "catch/catch.hpp"
+
+#include <algorithm>  // std::all_of
+#include <cstddef>    // std::size_t
+#include <cstdint>    // std::uintptr_t
+#include <utility>    // std::move
+
+TEST_CASE("mmap allocator", "[allocator]") {
+    using allocator_type = cpp_util::mmap_allocator<int>;
+    constexpr std::size_t huge_page_size = allocator_type::huge_page_size;
+    const auto is_aligned = [](const void* ptr, const std::size_t alignment) {
+        return reinterpret_cast<std::uintptr_t>(ptr) % alignment == 0;
+    };
+
+    const std::size_t small_size = 16;
+    const std::size_t large_size = huge_page_size / sizeof(int) + 3;
+
+    SECTION("state") {
+        const allocator_type alloc{};
+        CHECK(alloc.backing() == cpp_util::page_backing::transparent_huge_pages);
+        CHECK(alloc.threshold() == allocator_type::default_threshold);
+
+        const cpp_util::mmap_allocator<double> other{ allocator_type{ cpp_util::page_backing::normal, 42 } };
+        CHECK(other.backing() == cpp_util::page_backing::normal);
+        CHECK(other.threshold() == 42);
+        CHECK(allocator_type{ cpp_util::page_backing::normal, 42 } == allocator_type{ other });
+        CHECK(allocator_type{ cpp_util::page_backing::normal, 42 } != allocator_type{ cpp_util::page_backing::normal, 43 });
+    }
+
+    for (const cpp_util::page_backing backing : { cpp_util::page_backing::normal, cpp_util::page_backing::transparent_huge_pages,
+                                                  cpp_util::page_backing::explicit_huge_pages }) {
+        const allocator_type alloc{ backing };
+
+        SECTION("below and above the threshold") {
+            const cpp_util::huge_page_dynarray<int> small(small_size, 42, alloc);
+            REQUIRE(small.size() == small_size);
+            CHECK(std::all_of(small.begin(), small.end(), [](const int i) { return i == 42; }));
+
+            const cpp_util::huge_page_dynarray<int> large(large_size, 42, alloc);
+            REQUIRE(large.size() == large_size);
+            CHECK(std::all_of(large.begin(), large.end(), [](const int i) { return i == 42; }));
+#if defined(__unix__) || defined(__APPLE__)
+            CHECK(is_aligned(large.data(), backing == cpp_util::page_backing::normal ? 4096 : huge_page_size));
+#endif
+        }
+
+        SECTION("value_init uses the zeroed mapping") {
+            const cpp_util::huge_page_dynarray<int> small(small_size, cpp_util::value_init, alloc);
+            CHECK(std::all_of(small.begin(), small.end(), [](const int i) { return i == 0; }));
+            const cpp_util::huge_page_dynarray<int> large(large_size, cpp_util::value_init, alloc);
+            CHECK(std::all_of(large.begin(), large.end(), [](const int i) { return i == 0; }));
+        }
+
+        SECTION("copy and move") {
+            const cpp_util::huge_page_dynarray<int> arr(large_size, 1, alloc);
+            const cpp_util::huge_page_dynarray<int> copy{ arr };
+            CHECK(copy.get_allocator() == alloc);
+            CHECK(copy == arr);
+
+            // the allocators of both arrays differ -> the allocator must propagate
+            cpp_util::huge_page_dynarray<int> other(small_size, 2, allocator_type{ cpp_util::page_backing::normal, 1 });
+            other = copy;
+            CHECK(other.get_allocator() == alloc);
+            CHECK(other == arr);
+
+            cpp_util::huge_page_dynarray<int> moved(small_size, 2, allocator_type{ cpp_util::page_backing::normal, 1 });
+            const int* data = other.data();
+            moved = std::move(other);
+            CHECK(moved.data() == data);
+            CHECK(moved.get_allocator() == alloc);
+        }
+    }
+}
@@ -10,6 +10,68 @@
 #include "catch/catch.hpp"
 
 #include <algorithm>  // std::swap, std::all_of
+#include <cstddef>    // std::size_t
+#include <cstdint>    // std::uint8_t, std::uint32_t, std::int64_t
+#include <random>     // std::mt19937, std::uniform_int_distribution
+#include <vector>     // std::vector
+
+#if __has_include(<compare>)
+#include <compare>  // std::strong_ordering
+#endif
+
+namespace {
+
+// wrapper disabling the bitwise comparisons, i.e., forcing the generic std:: algorithms
+template <typename T>
+struct generic {
+    T value;
+
+    friend bool operator==(const generic& lhs, const generic& rhs) { return lhs.value == rhs.value; }
+    friend bool operator<(const generic& lhs, const generic& rhs) { return lhs.value < rhs.value; }
+#if defined(__cpp_impl_three_way_comparison) && defined(__cpp_lib_three_way_comparison)
+    friend std::strong_ordering operator<=>(const generic& lhs, const generic& rhs) { return lhs.value <=> rhs.value; }
+#endif
+};
+
+// checks that the bitwise comparisons of random arrays (with common prefixes) yield the same results as the generic comparisons
+template <typename T>
+void check_bitwise_comparisons() {
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> value_dist(-3, 3);
+    std::uniform_int_distribution<std::size_t> size_dist(0, 100);
+
+    for (int iteration = 0; iteration < 200; ++iteration) {
+        std::vector<T> lhs_vec(size_dist(gen));
+        for (std::size_t i = 0; i < lhs_vec.size(); ++i) {
+            lhs_vec[i] = static_cast<T>(value_dist(gen));
+        }
+        // introduce a single mismatch in a copy of lhs or use a different size
+        std::vector<T> rhs_vec = lhs_vec;
+        if (!rhs_vec.empty() && iteration % 3 != 0) {
+            rhs_vec[std::uniform_int_distribution<std::size_t>(0, rhs_vec.size() - 1)(gen)] = static_cast<T>(value_dist(gen));
+        } else if (iteration % 2 == 0) {
+            rhs_vec.push_back(static_cast<T>(value_dist(gen)));
+        }
+
+        const cpp_util::dynarray<T> lhs(lhs_vec.begin(), lhs_vec.end());
+        const cpp_util::dynarray<T> rhs(rhs_vec.begin(), rhs_vec.end());
+        std::vector<generic<T>> lhs_generic_vec, rhs_generic_vec;
+        for (const T val : lhs_vec) lhs_generic_vec.push_back(generic<T>{ val });
+        for (const T val : rhs_vec) rhs_generic_vec.push_back(generic<T>{ val });
+        const cpp_util::dynarray<generic<T>> lhs_generic(lhs_generic_vec.begin(), lhs_generic_vec.end());
+        const cpp_util::dynarray<generic<T>> rhs_generic(rhs_generic_vec.begin(), rhs_generic_vec.end());
+
+        CHECK((lhs == rhs) == (lhs_generic == rhs_generic));
+        CHECK((lhs != rhs) == (lhs_generic != rhs_generic));
+        CHECK((lhs < rhs) == (lhs_generic < rhs_generic));
+        CHECK((lhs <= rhs) == (lhs_generic <= rhs_generic));
+        CHECK((lhs > rhs) == (lhs_generic > rhs_generic));
+        CHECK((lhs >= rhs) == (lhs_generic >= rhs_generic));
+        CHECK((rhs < lhs) == (rhs_generic < lhs_generic));
+    }
+}
+
+}  // namespace
 
 TEST_CASE("dynarray non-member functions", "[non-member]") {
     SECTION("swap() free function") {
@@ -55,4 +117,14 @@ TEST_CASE("dynarray non-member functions", "[non-member]") {
         CHECK_FALSE(arr1 > arr3);
         CHECK(arr1 >= arr3);
     }
+
+    SECTION("bitwise comparisons") {
+        check_bitwise_comparisons<std::uint8_t>();
+        check_bitwise_comparisons<char>();
+        check_bitwise_comparisons<signed char>();
+        check_bitwise_comparisons<int>();
+        check_bitwise_comparisons<std::uint32_t>();
+        check_bitwise_comparisons<std::int64_t>();
+        check_bitwise_comparisons<bool>();
+    }
 }
@@ -0,0 +1,217 @@
+/**
+ * Copyright (C) 2021 - Marcel Breyer - All Rights Reserved
+ * Licensed under the MIT License. See LICENSE.md file in the project root for full license information.
+ *
+ * Implements tests for reading and writing cpp_util::dynarray and cpp_util::md_dynarray in the NumPy .npy format.
+ */
+
+#include "npy_io.hpp"
+
+#include "catch/catch.hpp"
+
+#include <algorithm>  // std::reverse
+#include <array>      // std::array
+#include <complex>    // std::complex
+#include <cstddef>    // std::size_t
+#include <cstdint>    // std::int8_t, std::uint16_t, std::int32_t
+#include <cstdio>     // std::tmpfile, std::fclose, std::FILE
+#include <sstream>    // std::stringstream
+#include <stdexcept>  // std::runtime_error
+#include <string>     // std::string
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>  // ::lseek, ::fileno
+#endif
+
+namespace {
+
+using extents2 = std::array<std::size_t, 2>;
+using extents3 = std::array<std::size_t, 3>;
+
+// a .npy file with the header dictionary @p dict (unpadded, i.e., the data isn't aligned) followed by @p data
+std::string make_npy(const std::string& dict, const std::string& data, const unsigned char version = 1) {
+    std::string npy("\x93NUMPY", 6);
+    npy += static_cast<char>(version);
+    npy += '\0';
+    const std::size_t length = dict.size() + 1;
+    for (std::size_t i = 0; i < (version == 1 ? 2u : 4u); ++i) {
+        npy += static_cast<char>((length >> (8 * i)) & 0xFF);
+    }
+    return npy + dict + '\n' + data;
+}
+
+// the bytes of @p values with each word of @p word_size bytes reversed
+template <typename T>
+std::string opposite_byte_order(const cpp_util::dynarray<T>& values, const std::size_t word_size) {
+    std::string data(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
+    for (std::size_t offset = 0; offset < data.size(); offset += word_size) {
+        std::reverse(&data[offset], &data[offset] + word_size);
+    }
+    return data;
+}
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+constexpr char opposite = '<';
+#else
+constexpr char opposite = '>';
+#endif
+
+}  // namespace
+
+TEST_CASE("npy serialization", "[npy_io]") {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    SECTION("numpy.save format") {
+        // the output of numpy.save(file, numpy.arange(3, dtype='<f8'))
+        std::string expected("\x93NUMPY\x01\x00\x76\x00", 10);
+        expected += "{'descr': '<f8', 'fortran_order': False, 'shape': (3,), }";
+        expected.append(127 - expected.size(), ' ');
+        expected += '\n';
+
+        std::stringstream stream;
+        cpp_util::write_npy(stream, cpp_util::dynarray<double>{ 0.0, 1.0, 2.0 });
+        const std::string npy = stream.str();
+        REQUIRE(npy.size() == 128 + 3 * sizeof(double));
+        CHECK(npy.substr(0, 128) == expected);
+    }
+#endif
+
+    SECTION("round trip") {
+        cpp_util::dynarray<float> arr(1000);
+        arr.iota(0.5f);
+        std::stringstream stream;
+        cpp_util::write_npy(stream, arr);
+        // the data is aligned to 64 bytes
+        CHECK((stream.str().size() - arr.size() * sizeof(float)) % 64 == 0);
+        CHECK(cpp_util::read_npy<float>(stream) == arr);
+
+        std::stringstream empty_stream;
+        cpp_util::write_npy(empty_stream, cpp_util::dynarray<int>{});
+        CHECK(cpp_util::read_npy<int>(empty_stream).empty());
+    }
+
+    SECTION("dtypes") {
+        const cpp_util::dynarray<std::int8_t> int8 = { -1, 2, -3 };
+        const cpp_util::dynarray<std::uint16_t> uint16 = { 1, 65535 };
+        const cpp_util::dynarray<bool> boolean = { true, false, true };
+        const cpp_util::dynarray<std::complex<double>> complex = { { 1.0, -1.0 }, { 0.5, 2.0 } };
+        std::stringstream stream;
+        cpp_util::write_npy(stream, int8);
+        cpp_util::write_npy(stream, uint16);
+        cpp_util::write_npy(stream, boolean);
+        cpp_util::write_npy(stream, complex);
+        CHECK(stream.str().find("'descr': '|i1'") != std::string::npos);
+        CHECK(stream.str().find("'descr': '|b1'") != std::string::npos);
+        CHECK(stream.str().find("u2'") != std::string::npos);
+        CHECK(stream.str().find("c16'") != std::string::npos);
+
+        CHECK(cpp_util::read_npy<std::int8_t>(stream) == int8);
+        CHECK(cpp_util::read_npy<std::uint16_t>(stream) == uint16);
+        CHECK(cpp_util::read_npy<bool>(stream) == boolean);
+        CHECK(cpp_util::read_npy<std::complex<double>>(stream) == complex);
+    }
+
+    SECTION("md_dynarray") {
+        cpp_util::md_dynarray<double, 2> row_major(extents2{ { 2, 3 } });
+        cpp_util::md_dynarray<double, 2, cpp_util::layout_column_major> column_major(extents2{ { 2, 3 } });
+        for (std::size_t i = 0; i < 2; ++i) {
+            for (std::size_t j = 0; j < 3; ++j) {
+                row_major(i, j) = static_cast<double>(10 * i + j);
+                column_major(i, j) = static_cast<double>(10 * i + j);
+            }
+        }
+
+        std::stringstream c_order;
+        cpp_util::write_npy(c_order, row_major);
+        CHECK(c_order.str().find("'fortran_order': False, 'shape': (2, 3), }") != std::string::npos);
+        std::stringstream fortran_order;
+        cpp_util::write_npy(fortran_order, column_major);
+        CHECK(fortran_order.str().find("'fortran_order': True, 'shape': (2, 3), }") != std::string::npos);
+
+        const cpp_util::md_dynarray<double, 2> read_row_major = cpp_util::read_npy<double, 2>(c_order);
+        CHECK(read_row_major == row_major);
+        const auto read_column_major = cpp_util::read_npy<double, 2, cpp_util::layout_column_major>(fortran_order);
+        CHECK(read_column_major == column_major);
+        CHECK(read_column_major(1, 2) == 12.0);
+    }
+
+    SECTION("md_dynarray mismatches") {
+        std::stringstream stream;
+        cpp_util::write_npy(stream, cpp_util::md_dynarray<int, 2>(extents2{ { 2, 2 } }));
+        const std::string npy = stream.str();
+
+        std::stringstream wrong_order{ npy };
+        CHECK_THROWS_AS((cpp_util::read_npy<int, 2, cpp_util::layout_column_major>(wrong_order)), std::runtime_error);
+        std::stringstream wrong_rank{ npy };
+        CHECK_THROWS_AS((cpp_util::read_npy<int, 3>(wrong_rank)), std::runtime_error);
+        // only one-dimensional data can be read into a dynarray
+        std::stringstream two_dimensional{ npy };
+        CHECK_THROWS_AS(cpp_util::read_npy<int>(two_dimensional), std::runtime_error);
+
+        // one-dimensional data is the same in both orders
+        std::stringstream one_dimensional;
+        cpp_util::write_npy(one_dimensional, cpp_util::dynarray<int>{ 1, 2, 3 });
+        CHECK((cpp_util::read_npy<int, 1, cpp_util::layout_column_major>(one_dimensional)(2) == 3));
+    }
+
+    SECTION("opposite byte order") {
+        const cpp_util::dynarray<std::int32_t> ints = { 1, -2, 0x01020304 };
+        std::stringstream int_stream{ make_npy(std::string{ "{'descr': '" } + opposite + "i4', 'fortran_order': False, 'shape': (3,), }",
+                                               opposite_byte_order(ints, 4)) };
+        CHECK(cpp_util::read_npy<std::int32_t>(int_stream) == ints);
+
+        const cpp_util::dynarray<std::complex<float>> complex = { { 1.0f, 2.0f }, { -3.0f, 4.5f } };
+        std::stringstream complex_stream{ make_npy(
+            std::string{ "{'descr': '" } + opposite + "c8', 'fortran_order': False, 'shape': (2,), }", opposite_byte_order(complex, 4)) };
+        CHECK(cpp_util::read_npy<std::complex<float>>(complex_stream) == complex);
+    }
+
+    SECTION("header variants") {
+        const cpp_util::dynarray<std::int8_t> values = { 1, 2 };
+        const std::string data(reinterpret_cast<const char*>(values.data()), values.size());
+        // different key order, double quotes, no trailing comma, and version 2.0
+        std::stringstream stream{ make_npy("{\"shape\": (2,), \"fortran_order\": False, \"descr\": \"|i1\"}", data, 2) };
+        CHECK(cpp_util::read_npy<std::int8_t>(stream) == values);
+        std::stringstream version_3{ make_npy("{'descr': '|i1', 'fortran_order': False, 'shape': (2,)}", data, 3) };
+        CHECK(cpp_util::read_npy<std::int8_t>(version_3) == values);
+    }
+
+    SECTION("invalid data") {
+        const std::string data(8, '\0');
+        const auto read = [](const std::string& npy) {
+            std::stringstream stream{ npy };
+            return cpp_util::read_npy<std::int32_t>(stream);
+        };
+        // dtype mismatch
+        CHECK_THROWS_AS(read(make_npy("{'descr': '<u4', 'fortran_order': False, 'shape': (2,), }", data)), std::runtime_error);
+        CHECK_THROWS_AS(read(make_npy("{'descr': '<i8', 'fortran_order': False, 'shape': (1,), }", data)), std::runtime_error);
+        // structured dtype
+        CHECK_THROWS_AS(read(make_npy("{'descr': [('x', '<i4')], 'fortran_order': False, 'shape': (2,), }", data)), std::runtime_error);
+        // missing or unknown keys
+        CHECK_THROWS_AS(read(make_npy("{'descr': '<i4', 'shape': (2,), }", data)), std::runtime_error);
+        CHECK_THROWS_AS(read(make_npy("{'descr': '<i4', 'fortran_order': False, 'shape': (2,), 'x': 1}", data)), std::runtime_error);
+        // truncated data
+        CHECK_THROWS_AS(read(make_npy("{'descr': '<i4', 'fortran_order': False, 'shape': (3,), }", data)), std::runtime_error);
+        // unsupported version
+        CHECK_THROWS_AS(read(make_npy("{'descr': '<i4', 'fortran_order': False, 'shape': (2,), }", data, 4)), std::runtime_error);
+        // not a .npy file
+        CHECK_THROWS_AS(read(std::string(128, 'x')), std::runtime_error);
+    }
+
+#if defined(__unix__) || defined(__APPLE__)
+    SECTION("file descriptor") {
+        std::FILE* file = std::tmpfile();
+        REQUIRE(file != nullptr);
+        const int fd = ::fileno(file);
+
+        cpp_util::dynarray<double> arr(1 << 16);
+        arr.iota();
+        cpp_util::md_dynarray<float, 3> md(extents3{ { 4, 5, 6 } }, 1.5f);
+        cpp_util::write_npy(fd, arr);
+        cpp_util::write_npy(fd, md);
+        REQUIRE(::lseek(fd, 0, SEEK_SET) == 0);
+        CHECK(cpp_util::read_npy<double>(fd) == arr);
+        CHECK((cpp_util::read_npy<float, 3>(fd) == md));
+        std::fclose(file);
+    }
+#endif
+}
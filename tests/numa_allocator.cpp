@@ -0,0 +1,69 @@
+/**
+ * Copyright (C) 2021 - Marcel Breyer - All Rights Reserved
+ * Licensed under the MIT License. See LICENSE.md file in the project root for full license information.
+ *
+ * Implements tests for the cpp_util::numa_allocator class.
+ */
+
+#include "numa_allocator.hpp"
+
+#include "catch/catch.hpp"
+
+#include <algorithm>  // std::all_of
+#include <cstddef>    // std::size_t
+#include <stdexcept>  // std::invalid_argument
+
+TEST_CASE("numa allocator", "[allocator]") {
+    using allocator_type = cpp_util::numa_allocator<double>;
+    // large enough to be served by a mapping
+    const std::size_t size = cpp_util::mmap_allocator<double>::huge_page_size / sizeof(double) * 2;
+
+    SECTION("state") {
+        const allocator_type alloc{};
+        CHECK(alloc.placement() == cpp_util::numa_placement::first_touch);
+        // huge pages would be placed per huge page instead of per chunk
+        CHECK(alloc.upstream() == cpp_util::mmap_allocator<double>{ cpp_util::page_backing::normal });
+
+        const cpp_util::numa_allocator<int> other{ allocator_type{ cpp_util::numa_placement::bind, 0 } };
+        CHECK(other.placement() == cpp_util::numa_placement::bind);
+        CHECK(other.node() == 0);
+        CHECK(allocator_type{ other } == allocator_type{ cpp_util::numa_placement::bind, 0 });
+        CHECK(allocator_type{ other } != allocator_type{ cpp_util::numa_placement::interleave });
+
+        CHECK_THROWS_AS(allocator_type(cpp_util::numa_placement::bind, -1), std::invalid_argument);
+        CHECK_THROWS_AS(allocator_type(cpp_util::numa_placement::bind, 4096), std::invalid_argument);
+    }
+
+    SECTION("allowed nodes") {
+        CHECK(cpp_util::numa_allowed_nodes() != 0);
+    }
+
+    SECTION("first touch by the worker threads") {
+        cpp_util::numa_dynarray<double> arr(size, cpp_util::for_overwrite);
+        arr.fill(cpp_util::par, 42.0);
+        CHECK(std::all_of(arr.begin(), arr.end(), [](const double d) { return d == 42.0; }));
+    }
+
+    SECTION("interleave") {
+        const cpp_util::numa_dynarray<double> arr(size, 42.0, allocator_type{ cpp_util::numa_placement::interleave });
+        CHECK(std::all_of(arr.begin(), arr.end(), [](const double d) { return d == 42.0; }));
+    }
+
+    SECTION("bind") {
+        // node 0 always exists
+        const cpp_util::numa_dynarray<double> arr(size, 42.0, allocator_type{ cpp_util::numa_placement::bind, 0 });
+        CHECK(std::all_of(arr.begin(), arr.end(), [](const double d) { return d == 42.0; }));
+#if defined(__linux__)
+        CHECK(cpp_util::numa_node_of(arr.data()) == 0);
+        CHECK(cpp_util::numa_node_of(arr.data() + size - 1) == 0);
+#endif
+
+        const cpp_util::numa_dynarray<double> zeroed(size, cpp_util::value_init, allocator_type{ cpp_util::numa_placement::bind, 0 });
+        CHECK(std::all_of(zeroed.begin(), zeroed.end(), [](const double d) { return d == 0.0; }));
+    }
+
+    SECTION("small allocations aren't placed") {
+        const cpp_util::numa_dynarray<double> arr(16, 42.0, allocator_type{ cpp_util::numa_placement::bind, 0 });
+        CHECK(std::all_of(arr.begin(), arr.end(), [](const double d) { return d == 42.0; }));
+    }
+}
@@ -11,6 +11,7 @@
 
 #include <algorithm>  // std::all_of
 #include <cstddef>    // std::size_t
+#include <stdexcept>  // std::runtime_error
 
 TEST_CASE("dynarray other member functions", "[operations]") {
     SECTION("swap() member function") {
@@ -60,4 +61,38 @@ TEST_CASE("dynarray other member functions", "[operations]") {
             CHECK(arr[i] == static_cast<int>(i) * 2);
         }
     }
+
+    // large enough to be split into multiple chunks
+    cpp_util::dynarray<int> large_arr(1 << 20);
+
+    SECTION("parallel fill() member function") {
+        large_arr.fill(cpp_util::par);
+        CHECK(std::all_of(large_arr.begin(), large_arr.end(), [](const int i) { return i == 0; }));
+
+        large_arr.fill(cpp_util::par(4), 42);
+        CHECK(std::all_of(large_arr.begin(), large_arr.end(), [](const int i) { return i == 42; }));
+    }
+
+    SECTION("parallel iota() member function") {
+        large_arr.iota(cpp_util::par(4), 42);
+        cpp_util::dynarray<int> serial_arr(large_arr.size());
+        serial_arr.iota(42);
+        CHECK(large_arr == serial_arr);
+    }
+
+    SECTION("parallel generate() member function") {
+        large_arr.generate(cpp_util::par(3), [](const std::size_t i) { return static_cast<int>(i) * 2; });
+        cpp_util::dynarray<int> serial_arr(large_arr.size());
+        int n = 0;
+        serial_arr.generate([&]() { return n++ * 2; });
+        CHECK(large_arr == serial_arr);
+
+        // exceptions are propagated to the calling thread
+        CHECK_THROWS_AS(large_arr.generate(cpp_util::par(4),
+                                           [](const std::size_t i) -> int {
+                                               if (i == 1000000) throw std::runtime_error{ "generation failed" };
+                                               return 0;
+                                           }),
+                        std::runtime_error);
+    }
 }
@@ -0,0 +1,105 @@
+/**
+ * Copyright (C) 2021 - Marcel Breyer - All Rights Reserved
+ * Licensed under the MIT License. See LICENSE.md file in the project root for full license information.
+ *
+ * Implements tests for the cpp_util::pmr::dynarray alias using a std::pmr::polymorphic_allocator.
+ */
+
+#include "dynarray.hpp"
+
+#include "catch/catch.hpp"
+
+#if defined(__cpp_lib_memory_resource)
+
+#include <algorithm>        // std::all_of
+#include <cstddef>          // std::size_t, std::byte
+#include <memory_resource>  // std::pmr::memory_resource, std::pmr::monotonic_buffer_resource, std::pmr::null_memory_resource
+#include <string>           // std::pmr::string
+#include <type_traits>      // std::is_same
+
+namespace {
+
+// memory resource counting the number of allocations
+class counting_resource : public std::pmr::memory_resource {
+ public:
+    std::size_t allocations{ 0 };
+    std::size_t bytes{ 0 };
+
+ private:
+    void* do_allocate(const std::size_t size, const std::size_t alignment) override {
+        ++allocations;
+        bytes += size;
+        return std::pmr::new_delete_resource()->allocate(size, alignment);
+    }
+    void do_deallocate(void* ptr, const std::size_t size, const std::size_t alignment) override {
+        std::pmr::new_delete_resource()->deallocate(ptr, size, alignment);
+    }
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+};
+
+}  // namespace
+
+TEST_CASE("pmr dynarray", "[pmr]") {
+    // long enough to disable the small string optimization
+    const char* long_string = "a string which doesn't fit into the small string buffer";
+
+    SECTION("member types") {
+        CHECK(std::is_same<typename cpp_util::pmr::dynarray<int>::allocator_type, std::pmr::polymorphic_allocator<int>>::value);
+    }
+
+    SECTION("monotonic buffer resource") {
+        std::byte buffer[1024];
+        std::pmr::monotonic_buffer_resource mr{ buffer, sizeof(buffer), std::pmr::null_memory_resource() };
+
+        const cpp_util::pmr::dynarray<int> arr(10, 42, &mr);
+        CHECK(arr.get_allocator().resource() == &mr);
+        CHECK(static_cast<const void*>(arr.data()) >= static_cast<const void*>(buffer));
+        CHECK(static_cast<const void*>(arr.data() + arr.size()) <= static_cast<const void*>(buffer + sizeof(buffer)));
+        CHECK(std::all_of(arr.begin(), arr.end(), [](const int i) { return i == 42; }));
+    }
+
+    SECTION("uses-allocator construction of the elements") {
+        counting_resource mr;
+        const cpp_util::pmr::dynarray<std::pmr::string> arr(3, long_string, &mr);
+        CHECK(std::all_of(arr.begin(), arr.end(), [&](const std::pmr::string& str) { return str.get_allocator().resource() == &mr; }));
+        // the array itself + one buffer per string
+        CHECK(mr.allocations == 4);
+
+        counting_resource other_mr;
+        const cpp_util::pmr::dynarray<std::pmr::string> copy(arr, &other_mr);
+        CHECK(copy == arr);
+        CHECK(std::all_of(copy.begin(), copy.end(),
+                          [&](const std::pmr::string& str) { return str.get_allocator().resource() == &other_mr; }));
+    }
+
+    SECTION("uses-allocator construction for overwrite") {
+        counting_resource mr;
+        const cpp_util::pmr::dynarray<std::pmr::string> arr(4, cpp_util::for_overwrite, &mr);
+        CHECK(std::all_of(arr.begin(), arr.end(), [&](const std::pmr::string& str) { return str.get_allocator().resource() == &mr; }));
+        CHECK(std::all_of(arr.begin(), arr.end(), [](const std::pmr::string& str) { return str.empty(); }));
+    }
+
+    SECTION("nested dynarrays") {
+        counting_resource mr;
+        const cpp_util::pmr::dynarray<int> inner{ 1, 2, 3 };
+        const cpp_util::pmr::dynarray<cpp_util::pmr::dynarray<int>> arr(2, inner, &mr);
+        REQUIRE(arr.size() == 2);
+        CHECK(arr[0] == inner);
+        CHECK(arr[1].get_allocator().resource() == &mr);
+        CHECK(mr.allocations == 3);
+
+        const cpp_util::pmr::dynarray<cpp_util::pmr::dynarray<int>> value_initialized(2, &mr);
+        CHECK(value_initialized[0].empty());
+        CHECK(value_initialized[0].get_allocator().resource() == &mr);
+    }
+
+    SECTION("copy construction uses the default resource") {
+        counting_resource mr;
+        const cpp_util::pmr::dynarray<int> arr(10, 42, &mr);
+        const cpp_util::pmr::dynarray<int> copy{ arr };
+        CHECK(copy.get_allocator().resource() == std::pmr::get_default_resource());
+        CHECK(copy == arr);
+    }
+}
+
+#endif
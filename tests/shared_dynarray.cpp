@@ -0,0 +1,141 @@
+/**
+ * Copyright (C) 2021 - Marcel Breyer - All Rights Reserved
+ * Licensed under the MIT License. See LICENSE.md file in the project root for full license information.
+ *
+ * Implements tests for the cpp_util::shared_dynarray class.
+ */
+
+#include "shared_dynarray.hpp"
+
+#include "catch/catch.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#include <algorithm>     // std::equal, std::all_of
+#include <cstddef>       // std::size_t
+#include <cstdint>       // std::uint32_t, std::uintptr_t
+#include <limits>        // std::numeric_limits
+#include <stdexcept>     // std::out_of_range, std::runtime_error, std::length_error
+#include <string>        // std::string, std::to_string
+#include <system_error>  // std::system_error
+#include <utility>       // std::move
+
+#include <sys/wait.h>  // ::waitpid, WIFEXITED, WEXITSTATUS
+#include <unistd.h>    // ::fork, ::getpid, ::_exit
+
+namespace {
+
+// a shared memory name unique to this process
+std::string shared_memory_name() { return "/cpp_util_shared_dynarray_" + std::to_string(::getpid()); }
+
+}  // namespace
+
+TEST_CASE("shared_dynarray", "[shared_dynarray]") {
+    const std::string name = shared_memory_name();
+
+    SECTION("create and attach by name") {
+        cpp_util::shared_dynarray<float> arr = cpp_util::shared_dynarray<float>::create(name, 1000);
+        REQUIRE(arr.size() == 1000);
+        // a new shared memory object is zero initialized
+        CHECK(std::all_of(arr.begin(), arr.end(), [](const float val) { return val == 0.0f; }));
+        CHECK(reinterpret_cast<std::uintptr_t>(arr.data()) % 64 == 0);
+        CHECK(arr.fd() == -1);
+        arr.iota(1.0f);
+
+        // a second mapping of the same elements
+        cpp_util::shared_dynarray<float> writer = cpp_util::shared_dynarray<float>::attach(name);
+        const cpp_util::shared_dynarray<const float> reader = cpp_util::shared_dynarray<const float>::attach(name);
+        REQUIRE(writer.size() == 1000);
+        REQUIRE(reader.size() == 1000);
+        CHECK(writer.data() != arr.data());
+        CHECK(std::equal(reader.begin(), reader.end(), arr.begin()));
+        CHECK(reader.at(999) == 1000.0f);
+        CHECK_THROWS_AS(reader.at(1000), std::out_of_range);
+
+        // modifications are visible immediately
+        writer.front() = -1.0f;
+        writer.at(500) = -2.0f;
+        CHECK(arr[0] == -1.0f);
+        CHECK(reader[500] == -2.0f);
+        CHECK(*reader.rbegin() == 1000.0f);
+        CHECK(writer == arr);
+
+        // the name already exists
+        CHECK_THROWS_AS(cpp_util::shared_dynarray<float>::create(name, 10), std::system_error);
+    }
+
+    SECTION("element type mismatch") {
+        const cpp_util::shared_dynarray<double> arr = cpp_util::shared_dynarray<double>::create(name, 10);
+        CHECK_THROWS_AS(cpp_util::shared_dynarray<float>::attach(name), std::runtime_error);
+        CHECK_THROWS_AS(cpp_util::shared_dynarray<const std::uint32_t>::attach(name), std::runtime_error);
+        CHECK(cpp_util::shared_dynarray<const double>::attach(name).size() == 10);
+    }
+
+    SECTION("the creator removes the name") {
+        {
+            const cpp_util::shared_dynarray<int> arr = cpp_util::shared_dynarray<int>::create(name, 10);
+        }
+        CHECK_THROWS_AS(cpp_util::shared_dynarray<int>::attach(name), std::system_error);
+        CHECK_THROWS_AS(cpp_util::shared_dynarray<int>::create(name, (std::numeric_limits<std::size_t>::max)()), std::length_error);
+    }
+
+    SECTION("read-only attach from another process") {
+        cpp_util::shared_dynarray<int> arr = cpp_util::shared_dynarray<int>::create(name, 1 << 16);
+        arr.iota();
+
+        const ::pid_t pid = ::fork();
+        REQUIRE(pid >= 0);
+        if (pid == 0) {
+            bool ok = false;
+            try {
+                const cpp_util::shared_dynarray<const int> reader = cpp_util::shared_dynarray<const int>::attach(name);
+                ok = reader.size() == (1 << 16) && reader[12345] == 12345 && reader.back() == (1 << 16) - 1;
+            } catch (...) {
+            }
+            ::_exit(ok ? 0 : 1);
+        }
+        int status = 0;
+        REQUIRE(::waitpid(pid, &status, 0) == pid);
+        CHECK(WIFEXITED(status));
+        CHECK(WEXITSTATUS(status) == 0);
+    }
+
+#if defined(MFD_CLOEXEC)
+    SECTION("anonymous shared memory") {
+        cpp_util::shared_dynarray<double> arr = cpp_util::shared_dynarray<double>::create(100);
+        REQUIRE(arr.fd() >= 0);
+        arr.fill(2.5);
+
+        cpp_util::shared_dynarray<double> writer = cpp_util::shared_dynarray<double>::attach(arr.fd());
+        const cpp_util::shared_dynarray<const double> reader = cpp_util::shared_dynarray<const double>::attach(arr.fd());
+        writer.back() = 3.5;
+        CHECK(reader.size() == 100);
+        CHECK(reader.front() == 2.5);
+        CHECK(reader.back() == 3.5);
+        CHECK(arr.back() == 3.5);
+    }
+#endif
+
+    SECTION("move and swap") {
+        cpp_util::shared_dynarray<char> arr = cpp_util::shared_dynarray<char>::create(name, 3);
+        arr.generate([]() { return 'x'; });
+        cpp_util::shared_dynarray<char> moved{ std::move(arr) };
+        CHECK(arr.empty());
+        CHECK(moved.size() == 3);
+
+        cpp_util::shared_dynarray<const char> reader = cpp_util::shared_dynarray<const char>::attach(name);
+        cpp_util::shared_dynarray<const char> other{};
+        swap(reader, other);
+        CHECK(reader.empty());
+        CHECK(other.front() == 'x');
+        CHECK(reader < other);
+
+        // the moved-to shared_dynarray owns the name
+        arr = std::move(moved);
+        CHECK(arr.size() == 3);
+        moved = cpp_util::shared_dynarray<char>{};
+        CHECK_NOTHROW(cpp_util::shared_dynarray<char>::attach(name));
+    }
+}
+
+#endif
@@ -0,0 +1,188 @@
+/**
+ * Copyright (C) 2021 - Marcel Breyer - All Rights Reserved
+ * Licensed under the MIT License. See LICENSE.md file in the project root for full license information.
+ *
+ * Implements tests for the cpp_util::small_dynarray class.
+ */
+
+#include "small_dynarray.hpp"
+
+#include "catch/catch.hpp"
+
+#include <algorithm>  // std::all_of, std::equal
+#include <cstddef>    // std::size_t
+#include <stdexcept>  // std::out_of_range, std::runtime_error
+#include <string>     // std::string
+#include <utility>    // std::move
+#include <vector>     // std::vector
+
+namespace {
+
+// throws on the construction of the n-th instance and counts the live instances
+struct throwing_type {
+    throwing_type() { this->check(); }
+    throwing_type(const throwing_type&) { this->check(); }
+    throwing_type& operator=(const throwing_type&) = default;
+    ~throwing_type() { --live; }
+
+    void check() {
+        if (++constructions == throw_at) {
+            throw std::runtime_error{ "construction failed" };
+        }
+        ++live;
+    }
+
+    static int constructions;
+    static int throw_at;
+    static int live;
+};
+int throwing_type::constructions = 0;
+int throwing_type::throw_at = -1;
+int throwing_type::live = 0;
+
+}  // namespace
+
+TEST_CASE("small_dynarray construction", "[small_dynarray]") {
+    SECTION("default constructor") {
+        const cpp_util::small_dynarray<int, 4> arr;
+        CHECK(arr.empty());
+        CHECK(arr.is_inline());
+        CHECK(arr.begin() == arr.end());
+    }
+
+    SECTION("inline and heap storage") {
+        const cpp_util::small_dynarray<int, 4> small(4, 42);
+        CHECK(small.is_inline());
+        CHECK(static_cast<const void*>(small.data()) >= static_cast<const void*>(&small));
+        CHECK(static_cast<const void*>(small.data()) < static_cast<const void*>(&small + 1));
+        CHECK(std::all_of(small.begin(), small.end(), [](const int i) { return i == 42; }));
+
+        const cpp_util::small_dynarray<int, 4> large(5, 42);
+        CHECK_FALSE(large.is_inline());
+        REQUIRE(large.size() == 5);
+        CHECK(std::all_of(large.begin(), large.end(), [](const int i) { return i == 42; }));
+    }
+
+    SECTION("initialization tags") {
+        const cpp_util::small_dynarray<int, 4> value_initialized(3);
+        CHECK(std::all_of(value_initialized.begin(), value_initialized.end(), [](const int i) { return i == 0; }));
+        const cpp_util::small_dynarray<int, 4> zeroed(10, cpp_util::value_init);
+        CHECK(std::all_of(zeroed.begin(), zeroed.end(), [](const int i) { return i == 0; }));
+        const cpp_util::small_dynarray<std::string, 4> strings(3, cpp_util::for_overwrite);
+        CHECK(std::all_of(strings.begin(), strings.end(), [](const std::string& str) { return str.empty(); }));
+    }
+
+    SECTION("iterator range and initializer_list constructor") {
+        const std::vector<std::string> vec{ "a", "b", "c", "d", "e" };
+        const cpp_util::small_dynarray<std::string, 2> arr(vec.begin(), vec.end());
+        REQUIRE(arr.size() == vec.size());
+        CHECK(std::equal(arr.begin(), arr.end(), vec.begin()));
+
+        const cpp_util::small_dynarray<int, 8> ilist{ 1, 2, 3 };
+        REQUIRE(ilist.size() == 3);
+        CHECK(ilist[2] == 3);
+    }
+
+    SECTION("exception safety") {
+        for (const std::size_t size : { std::size_t{ 4 }, std::size_t{ 16 } }) {
+            throwing_type::constructions = 0;
+            throwing_type::throw_at = 3;
+            throwing_type::live = 0;
+            CHECK_THROWS_AS((cpp_util::small_dynarray<throwing_type, 8>(size)), std::runtime_error);
+            CHECK(throwing_type::live == 0);
+        }
+        throwing_type::throw_at = -1;
+    }
+}
+
+TEST_CASE("small_dynarray copy and move", "[small_dynarray]") {
+    for (const std::size_t size : { std::size_t{ 3 }, std::size_t{ 30 } }) {
+        cpp_util::small_dynarray<std::string, 4> arr(size, "foo");
+
+        SECTION("copy") {
+            const cpp_util::small_dynarray<std::string, 4> copy{ arr };
+            CHECK(copy == arr);
+            CHECK(copy.data() != arr.data());
+
+            cpp_util::small_dynarray<std::string, 4> assigned(7, "bar");
+            assigned = copy;
+            CHECK(assigned == arr);
+            assigned = assigned;
+            CHECK(assigned == arr);
+        }
+
+        SECTION("move") {
+            const std::string* data = arr.data();
+            cpp_util::small_dynarray<std::string, 4> moved{ std::move(arr) };
+            CHECK(arr.empty());
+            REQUIRE(moved.size() == size);
+            CHECK(std::all_of(moved.begin(), moved.end(), [](const std::string& str) { return str == "foo"; }));
+            // heap storage only moves the pointer
+            CHECK((moved.data() == data) == !moved.is_inline());
+
+            cpp_util::small_dynarray<std::string, 4> assigned(7, "bar");
+            assigned = std::move(moved);
+            CHECK(moved.empty());
+            REQUIRE(assigned.size() == size);
+            CHECK(assigned.front() == "foo");
+        }
+
+        SECTION("swap") {
+            cpp_util::small_dynarray<std::string, 4> other(2, "bar");
+            swap(arr, other);
+            CHECK(arr.size() == 2);
+            CHECK(arr.back() == "bar");
+            CHECK(other.size() == size);
+            CHECK(other.back() == "foo");
+        }
+
+        SECTION("assign") {
+            arr.assign(size, "bar");
+            CHECK(arr.size() == size);
+            CHECK(arr.front() == "bar");
+            arr.assign({ "a", "b", "c", "d", "e", "f" });
+            REQUIRE(arr.size() == 6);
+            CHECK(arr.back() == "f");
+            arr = { "x" };
+            CHECK(arr.size() == 1);
+            CHECK(arr.is_inline());
+        }
+    }
+}
+
+TEST_CASE("small_dynarray element access and operations", "[small_dynarray]") {
+    cpp_util::small_dynarray<int, 4> arr(6);
+
+    CHECK_THROWS_AS(arr.at(6), std::out_of_range);
+    arr.at(1) = 1;
+    CHECK(arr[1] == 1);
+
+    arr.iota(1);
+    CHECK(arr.front() == 1);
+    CHECK(arr.back() == 6);
+    CHECK(*arr.rbegin() == 6);
+    CHECK(arr.crend() - arr.crbegin() == 6);
+
+    arr.fill(42);
+    CHECK(std::all_of(arr.cbegin(), arr.cend(), [](const int i) { return i == 42; }));
+
+    int value = 0;
+    arr.generate([&]() { return value++; });
+    CHECK(arr.back() == 5);
+
+    CHECK(cpp_util::small_dynarray<int, 4>::inline_capacity() == 4);
+    CHECK(arr.max_size() == cpp_util::dynarray<int>::max_size());
+}
+
+TEST_CASE("small_dynarray comparisons", "[small_dynarray]") {
+    const cpp_util::small_dynarray<int, 4> arr1{ 1, 2, 3 };
+    const cpp_util::small_dynarray<int, 4> arr2{ 1, 2, 4 };
+    const cpp_util::small_dynarray<int, 4> arr3{ 1, 2, 3, 4, 5 };
+
+    CHECK(arr1 == arr1);
+    CHECK(arr1 != arr2);
+    CHECK(arr1 < arr2);
+    CHECK(arr2 > arr1);
+    CHECK(arr1 <= arr3);
+    CHECK(arr3 >= arr1);
+}
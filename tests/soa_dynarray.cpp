@@ -0,0 +1,189 @@
+/**
+ * Copyright (C) 2021 - Marcel Breyer - All Rights Reserved
+ * Licensed under the MIT License. See LICENSE.md file in the project root for full license information.
+ *
+ * Implements tests for the cpp_util::soa_dynarray class.
+ */
+
+#include "soa_dynarray.hpp"
+
+#include "catch/catch.hpp"
+
+#include <algorithm>    // std::all_of
+#include <cstddef>      // std::size_t
+#include <cstdint>      // std::uintptr_t
+#include <iterator>     // std::iterator_traits, std::input_iterator_tag, std::random_access_iterator_tag
+#include <stdexcept>    // std::out_of_range, std::runtime_error
+#include <string>       // std::string
+#include <tuple>        // std::tuple, std::make_tuple, std::get
+#include <type_traits>  // std::is_same
+#include <utility>      // std::move
+
+namespace {
+
+// x, y, z, id
+using particles = cpp_util::soa_dynarray<float, float, float, int>;
+
+// throws on the construction of the n-th instance and counts the live instances
+struct throwing_type {
+    throwing_type() { this->check(); }
+    throwing_type(const throwing_type&) { this->check(); }
+    throwing_type& operator=(const throwing_type&) = default;
+    ~throwing_type() { --live; }
+
+    void check() {
+        if (++constructions == throw_at) {
+            throw std::runtime_error{ "construction failed" };
+        }
+        ++live;
+    }
+
+    static int constructions;
+    static int throw_at;
+    static int live;
+};
+int throwing_type::constructions = 0;
+int throwing_type::throw_at = -1;
+int throwing_type::live = 0;
+
+bool is_cache_line_aligned(const void* ptr) { return reinterpret_cast<std::uintptr_t>(ptr) % cpp_util::detail::cache_line_size == 0; }
+
+}  // namespace
+
+TEST_CASE("soa_dynarray construction", "[soa_dynarray]") {
+    SECTION("default constructor") {
+        const particles arr;
+        CHECK(arr.empty());
+        CHECK(arr.size() == 0);
+        CHECK(arr.data<0>() == nullptr);
+        CHECK(arr.begin() == arr.end());
+        CHECK(particles::num_fields() == 4);
+    }
+
+    SECTION("size constructors") {
+        const particles arr(10);
+        REQUIRE(arr.size() == 10);
+        CHECK(std::all_of(arr.field<0>().begin(), arr.field<0>().end(), [](const float f) { return f == 0.0f; }));
+        CHECK(std::all_of(arr.field<3>().begin(), arr.field<3>().end(), [](const int i) { return i == 0; }));
+
+        const particles init(5, std::make_tuple(1.0f, 2.0f, 3.0f, 42));
+        CHECK(init[4] == std::make_tuple(1.0f, 2.0f, 3.0f, 42));
+
+        const cpp_util::soa_dynarray<int, std::string> overwrite(3, cpp_util::for_overwrite);
+        CHECK(std::all_of(overwrite.field<1>().begin(), overwrite.field<1>().end(), [](const std::string& str) { return str.empty(); }));
+    }
+
+    SECTION("one allocation with aligned fields") {
+        const cpp_util::soa_dynarray<char, double, short> arr(100);
+        CHECK(is_cache_line_aligned(arr.data<0>()));
+        CHECK(is_cache_line_aligned(arr.data<1>()));
+        CHECK(is_cache_line_aligned(arr.data<2>()));
+        // the fields are consecutive in the same buffer
+        CHECK(static_cast<const void*>(arr.data<1>()) == static_cast<const void*>(arr.data<0>() + 128));
+        CHECK(static_cast<const void*>(arr.data<2>()) == static_cast<const void*>(arr.data<1>() + 104));
+    }
+
+    SECTION("exception safety") {
+        throwing_type::constructions = 0;
+        throwing_type::throw_at = 5;
+        throwing_type::live = 0;
+        // the second field throws after the first field has been constructed completely
+        using soa_type = cpp_util::soa_dynarray<throwing_type, throwing_type>;
+        CHECK_THROWS_AS(soa_type(3), std::runtime_error);
+        CHECK(throwing_type::live == 0);
+        throwing_type::throw_at = -1;
+    }
+}
+
+TEST_CASE("soa_dynarray copy, move, and swap", "[soa_dynarray]") {
+    cpp_util::soa_dynarray<std::string, int> arr(4, std::make_tuple(std::string{ "foo" }, 1));
+
+    SECTION("copy") {
+        const cpp_util::soa_dynarray<std::string, int> copy{ arr };
+        CHECK(copy == arr);
+        CHECK(copy.data<0>() != arr.data<0>());
+
+        cpp_util::soa_dynarray<std::string, int> assigned(1);
+        assigned = copy;
+        CHECK(assigned == arr);
+        std::get<1>(assigned[2]) = 2;
+        CHECK(assigned != arr);
+    }
+
+    SECTION("move") {
+        const std::string* data = arr.data<0>();
+        cpp_util::soa_dynarray<std::string, int> moved{ std::move(arr) };
+        CHECK(arr.empty());
+        CHECK(moved.data<0>() == data);
+
+        cpp_util::soa_dynarray<std::string, int> assigned(1);
+        assigned = std::move(moved);
+        CHECK(moved.empty());
+        CHECK(assigned.data<0>() == data);
+    }
+
+    SECTION("swap") {
+        cpp_util::soa_dynarray<std::string, int> other(2);
+        swap(arr, other);
+        CHECK(arr.size() == 2);
+        CHECK(other.size() == 4);
+        CHECK(std::get<0>(other.front()) == "foo");
+    }
+}
+
+TEST_CASE("soa_dynarray element access", "[soa_dynarray]") {
+    particles arr(4);
+
+    SECTION("proxy references") {
+        arr[1] = std::make_tuple(1.0f, 2.0f, 3.0f, 4);
+        CHECK(arr.data<2>()[1] == 3.0f);
+        std::get<3>(arr.at(2)) = 42;
+        CHECK(arr.field<3>()[2] == 42);
+        CHECK_THROWS_AS(arr.at(4), std::out_of_range);
+
+        const particles::value_type value = arr[1];
+        CHECK(std::get<1>(value) == 2.0f);
+        arr.back() = value;
+        CHECK(std::get<0>(arr.back()) == 1.0f);
+    }
+
+    SECTION("iterators") {
+        int id = 0;
+        for (particles::reference particle : arr) {
+            std::get<0>(particle) = static_cast<float>(id);
+            std::get<3>(particle) = id++;
+        }
+        CHECK(arr.field<3>()[3] == 3);
+        CHECK(arr.end() - arr.begin() == 4);
+        CHECK(std::get<3>(arr.begin()[2]) == 2);
+        CHECK(std::get<3>(*(arr.cend() - 1)) == 3);
+        particles::const_iterator it = arr.begin();
+        CHECK(it < arr.cend());
+        CHECK(arr.cend() > it);
+        CHECK(it <= arr.cbegin());
+        CHECK(it >= arr.cbegin());
+        CHECK_FALSE(it > arr.cbegin());
+        CHECK_FALSE(arr.cend() <= it);
+    }
+
+    SECTION("iterator category") {
+        // proxy references -> only an input iterator for the legacy algorithms
+        CHECK((std::is_same<std::iterator_traits<particles::iterator>::iterator_category, std::input_iterator_tag>::value));
+        CHECK((std::is_same<std::iterator_traits<particles::const_iterator>::iterator_category, std::input_iterator_tag>::value));
+#if defined(__cpp_lib_ranges)
+        CHECK((std::is_same<particles::iterator::iterator_concept, std::random_access_iterator_tag>::value));
+        CHECK(std::random_access_iterator<particles::iterator>);
+        CHECK(std::ranges::distance(arr.begin(), arr.end()) == 4);
+#endif
+    }
+
+    SECTION("field views") {
+        arr.field<0>().iota(1.0f);
+        arr.field<1>().fill(2.0f);
+        arr.field<3>().generate([]() { return 7; });
+        CHECK(arr[3] == std::make_tuple(4.0f, 2.0f, 0.0f, 7));
+
+        arr.fill(std::make_tuple(0.0f, 0.0f, 0.0f, -1));
+        CHECK(arr.front() == std::make_tuple(0.0f, 0.0f, 0.0f, -1));
+    }
+}
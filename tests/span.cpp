@@ -0,0 +1,110 @@
+/**
+ * Copyright (C) 2021 - Marcel Breyer - All Rights Reserved
+ * Licensed under the MIT License. See LICENSE.md file in the project root for full license information.
+ *
+ * Implements tests for the zero-copy conversions to std::span and std::mdspan.
+ */
+
+#include "dynarray.hpp"
+#include "jagged_dynarray.hpp"
+#include "md_dynarray.hpp"
+#include "static_dynarray.hpp"
+
+#include "catch/catch.hpp"
+
+#if defined(__cpp_lib_span)
+
+#include <cstddef>      // std::size_t
+#include <numeric>      // std::accumulate
+#include <span>         // std::span
+#include <type_traits>  // std::is_convertible
+#include <utility>      // std::as_const
+
+namespace {
+
+int sum(const std::span<const int> values) { return std::accumulate(values.begin(), values.end(), 0); }
+
+}  // namespace
+
+TEST_CASE("span conversion", "[span]") {
+    SECTION("dynarray") {
+        cpp_util::dynarray<int> arr = { 1, 2, 3, 4 };
+
+        // the std::span refers to the elements of the cpp_util::dynarray, i.e., nothing is copied
+        const std::span<int> span = arr;
+        CHECK(span.data() == arr.data());
+        CHECK(span.size() == arr.size());
+        span[0] = 42;
+        CHECK(arr[0] == 42);
+
+        CHECK(sum(arr) == 51);
+        CHECK(sum(std::as_const(arr)) == 51);
+
+        // a temporary cpp_util::dynarray can't be bound to a mutable std::span
+        CHECK_FALSE((std::is_convertible<cpp_util::dynarray<int>, std::span<int>>::value));
+        CHECK((std::is_convertible<cpp_util::dynarray<int>&, std::span<int>>::value));
+        CHECK_FALSE((std::is_convertible<const cpp_util::dynarray<int>&, std::span<int>>::value));
+
+        // and a std::span can be copied into a new cpp_util::dynarray
+        const cpp_util::dynarray<int> copy(span.subspan(1));
+        REQUIRE(copy.size() == 3);
+        CHECK(copy[0] == 2);
+    }
+
+    SECTION("row_view") {
+        cpp_util::jagged_dynarray<int> jagged = { { 1, 2 }, { 3, 4, 5 } };
+
+        // a row_view doesn't own its elements, i.e., even a temporary can be converted
+        const std::span<int> row = jagged[1];
+        REQUIRE(row.size() == 3);
+        CHECK(row.data() == jagged.values().data() + 2);
+        CHECK(sum(jagged[0]) == 3);
+    }
+
+    SECTION("static_dynarray") {
+        cpp_util::static_dynarray<int, 4> arr = { 1, 2, 3, 4 };
+
+        const std::span<int, 4> span = arr;
+        CHECK(span.data() == arr.data());
+        const std::span<const int, 4> const_span = std::as_const(arr);
+        CHECK(const_span.data() == arr.data());
+        CHECK(sum(arr) == 10);
+
+        // the extent must match
+        CHECK_FALSE((std::is_convertible<cpp_util::static_dynarray<int, 4>&, std::span<int, 3>>::value));
+    }
+}
+
+#if defined(__cpp_lib_mdspan)
+
+TEST_CASE("mdspan conversion", "[span]") {
+    SECTION("dynarray") {
+        cpp_util::dynarray<int> arr(6);
+        arr.iota();
+
+        const auto mdspan = arr.as_mdspan(2, 3);
+        CHECK(mdspan.data_handle() == arr.data());
+        CHECK(mdspan.extent(0) == 2);
+        CHECK(mdspan.extent(1) == 3);
+        CHECK(mdspan[1, 2] == 5);
+
+        const auto column_major = std::as_const(arr).as_mdspan<std::layout_left>(2, 3);
+        CHECK(column_major[0, 1] == 2);
+        CHECK(column_major[1, 0] == 1);
+    }
+
+    SECTION("md_dynarray") {
+        cpp_util::md_dynarray<int, 2, cpp_util::layout_column_major> arr({ { 3, 4 } });
+        arr(2, 1) = 42;
+
+        const auto mdspan = arr.as_mdspan();
+        CHECK(mdspan.data_handle() == arr.data());
+        CHECK(mdspan[2, 1] == 42);
+        CHECK(mdspan.stride(0) == 1);
+        CHECK(mdspan.stride(1) == 3);
+    }
+}
+
+#endif
+
+#endif
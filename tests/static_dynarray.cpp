@@ -0,0 +1,148 @@
+/**
+ * Copyright (C) 2021 - Marcel Breyer - All Rights Reserved
+ * Licensed under the MIT License. See LICENSE.md file in the project root for full license information.
+ *
+ * Implements tests for the cpp_util::static_dynarray class.
+ */
+
+#include "static_dynarray.hpp"
+
+#include "catch/catch.hpp"
+
+#include <algorithm>    // std::all_of, std::equal
+#include <cstddef>      // std::size_t
+#include <stdexcept>    // std::out_of_range, std::length_error
+#include <string>       // std::string
+#include <type_traits>  // std::is_nothrow_move_constructible, std::is_nothrow_move_assignable
+#include <utility>      // std::move
+#include <vector>       // std::vector
+
+TEST_CASE("static_dynarray construction", "[static_dynarray]") {
+    SECTION("compile-time size") {
+        static_assert(cpp_util::static_dynarray<int, 16>::size() == 16, "size() must be a constant expression");
+        static_assert(!cpp_util::static_dynarray<int, 16>::empty(), "empty() must be a constant expression");
+        CHECK(cpp_util::static_dynarray<int, 0>::empty());
+    }
+
+    SECTION("initialization") {
+        const cpp_util::static_dynarray<int, 8> arr;
+        CHECK(std::all_of(arr.begin(), arr.end(), [](const int i) { return i == 0; }));
+        CHECK(arr.end() - arr.begin() == 8);
+
+        const cpp_util::static_dynarray<std::string, 3> strings("foo");
+        CHECK(std::all_of(strings.begin(), strings.end(), [](const std::string& str) { return str == "foo"; }));
+
+        const cpp_util::static_dynarray<std::string, 3> overwrite(cpp_util::for_overwrite);
+        CHECK(overwrite.back().empty());
+    }
+
+    SECTION("iterator range and initializer_list constructor") {
+        const std::vector<int> vec{ 1, 2, 3 };
+        const cpp_util::static_dynarray<int, 3> arr(vec.begin(), vec.end());
+        CHECK(std::equal(arr.begin(), arr.end(), vec.begin()));
+        CHECK_THROWS_AS((cpp_util::static_dynarray<int, 4>(vec.begin(), vec.end())), std::length_error);
+
+        const cpp_util::static_dynarray<int, 3> ilist{ 4, 5, 6 };
+        CHECK(ilist.front() == 4);
+        CHECK_THROWS_AS((cpp_util::static_dynarray<int, 2>{ 1, 2, 3 }), std::length_error);
+    }
+}
+
+TEST_CASE("static_dynarray conversions", "[static_dynarray]") {
+    SECTION("from dynarray") {
+        cpp_util::dynarray<int> dyn{ 1, 2, 3, 4 };
+        const cpp_util::static_dynarray<int, 4> copy{ dyn };
+        CHECK(std::equal(copy.begin(), copy.end(), dyn.begin()));
+
+        const int* data = dyn.data();
+        const cpp_util::static_dynarray<int, 4> moved{ std::move(dyn) };
+        CHECK(moved.data() == data);
+        CHECK(dyn.empty());
+
+        const cpp_util::dynarray<int> wrong_size(3);
+        CHECK_THROWS_AS((cpp_util::static_dynarray<int, 4>{ wrong_size }), std::length_error);
+    }
+
+    SECTION("to dynarray") {
+        cpp_util::static_dynarray<int, 4> arr{ 1, 2, 3, 4 };
+        const cpp_util::dynarray<int> copy = arr;
+        CHECK(copy == cpp_util::dynarray<int>{ 1, 2, 3, 4 });
+
+        const int* data = arr.data();
+        const cpp_util::dynarray<int> moved = std::move(arr);
+        CHECK(moved.data() == data);
+        // the moved-from array may only be assigned to
+        arr = cpp_util::static_dynarray<int, 4>{ 5, 6, 7, 8 };
+        CHECK(arr.front() == 5);
+    }
+}
+
+TEST_CASE("static_dynarray move semantics", "[static_dynarray]") {
+    // moving only transfers the buffer
+    CHECK(std::is_nothrow_move_constructible<cpp_util::static_dynarray<double, 1024>>::value);
+    CHECK(std::is_nothrow_move_assignable<cpp_util::static_dynarray<double, 1024>>::value);
+
+    cpp_util::static_dynarray<int, 4> arr{ 1, 2, 3, 4 };
+    const int* data = arr.data();
+
+    cpp_util::static_dynarray<int, 4> moved{ std::move(arr) };
+    CHECK(moved.data() == data);
+
+    // the moved-from array can be reassigned and used again
+    const cpp_util::static_dynarray<int, 4> values{ 5, 6, 7, 8 };
+    arr = values;
+    CHECK(arr == values);
+    arr.iota(1);
+    CHECK(arr.back() == 4);
+
+    // move assignment exchanges the buffers
+    cpp_util::static_dynarray<int, 4> assigned;
+    const int* old_data = assigned.data();
+    assigned = std::move(moved);
+    CHECK(assigned.data() == data);
+    CHECK(moved.data() == old_data);
+    CHECK(assigned == arr);
+
+    // move assigning to a moved-from array
+    cpp_util::static_dynarray<int, 4> target{ std::move(assigned) };
+    assigned = std::move(target);
+    CHECK(assigned.data() == data);
+    assigned.fill(cpp_util::par, 1);
+    CHECK(std::all_of(assigned.begin(), assigned.end(), [](const int i) { return i == 1; }));
+}
+
+TEST_CASE("static_dynarray element access and operations", "[static_dynarray]") {
+    cpp_util::static_dynarray<int, 6> arr;
+
+    CHECK_THROWS_AS(arr.at(6), std::out_of_range);
+    arr.at(1) = 1;
+    CHECK(arr[1] == 1);
+
+    arr.iota(1);
+    CHECK(arr.front() == 1);
+    CHECK(arr.back() == 6);
+    CHECK(*arr.rbegin() == 6);
+    CHECK(arr.crend() - arr.crbegin() == 6);
+
+    arr.fill(42);
+    CHECK(std::all_of(arr.cbegin(), arr.cend(), [](const int i) { return i == 42; }));
+    int value = 0;
+    arr.generate([&]() { return value++; });
+    CHECK(arr.back() == 5);
+    arr.fill(cpp_util::par, 7);
+    CHECK(arr.front() == 7);
+    arr.generate(cpp_util::par, [](const std::size_t pos) { return static_cast<int>(pos); });
+    CHECK(arr[3] == 3);
+
+    const cpp_util::static_dynarray<int, 6> other{ 0, 1, 2, 3, 4, 5 };
+    CHECK(arr == other);
+    CHECK_FALSE(arr != other);
+    const cpp_util::static_dynarray<int, 6> larger{ 0, 1, 2, 3, 5, 5 };
+    CHECK(arr < larger);
+    CHECK(larger >= arr);
+
+    cpp_util::static_dynarray<int, 6> swapped{ larger };
+    swap(arr, swapped);
+    CHECK(arr == larger);
+    CHECK(swapped == other);
+}
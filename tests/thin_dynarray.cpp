@@ -0,0 +1,185 @@
+/**
+ * Copyright (C) 2021 - Marcel Breyer - All Rights Reserved
+ * Licensed under the MIT License. See LICENSE.md file in the project root for full license information.
+ *
+ * Implements tests for the cpp_util::thin_dynarray class.
+ */
+
+#include "thin_dynarray.hpp"
+
+#include "catch/catch.hpp"
+
+#include <algorithm>  // std::all_of, std::equal
+#include <cstddef>    // std::size_t
+#include <cstdint>    // std::uintptr_t
+#include <stdexcept>  // std::out_of_range, std::runtime_error
+#include <string>     // std::string
+#include <utility>    // std::move
+#include <vector>     // std::vector
+
+namespace {
+
+// throws on the construction of the n-th instance and counts the live instances
+struct throwing_type {
+    throwing_type() { this->check(); }
+    throwing_type(const throwing_type&) { this->check(); }
+    throwing_type& operator=(const throwing_type&) = default;
+    ~throwing_type() { --live; }
+
+    void check() {
+        if (++constructions == throw_at) {
+            throw std::runtime_error{ "construction failed" };
+        }
+        ++live;
+    }
+
+    static int constructions;
+    static int throw_at;
+    static int live;
+};
+int throwing_type::constructions = 0;
+int throwing_type::throw_at = -1;
+int throwing_type::live = 0;
+
+#if defined(__cpp_aligned_new)
+struct alignas(64) over_aligned {
+    int value{ 0 };
+};
+#endif
+
+}  // namespace
+
+TEST_CASE("thin_dynarray construction", "[thin_dynarray]") {
+    SECTION("single pointer") {
+        CHECK(sizeof(cpp_util::thin_dynarray<int>) == sizeof(int*));
+        CHECK(sizeof(cpp_util::thin_dynarray<std::string>) == sizeof(std::string*));
+    }
+
+    SECTION("empty arrays don't allocate") {
+        const cpp_util::thin_dynarray<int> arr1;
+        CHECK(arr1.empty());
+        CHECK(arr1.size() == 0);
+        CHECK(arr1.data() == nullptr);
+        CHECK(arr1.begin() == arr1.end());
+
+        const cpp_util::thin_dynarray<int> arr2(0, 42);
+        CHECK(arr2.data() == nullptr);
+        CHECK(arr1 == arr2);
+    }
+
+    SECTION("size and value constructors") {
+        const cpp_util::thin_dynarray<int> arr1(10);
+        REQUIRE(arr1.size() == 10);
+        CHECK(std::all_of(arr1.begin(), arr1.end(), [](const int i) { return i == 0; }));
+
+        const cpp_util::thin_dynarray<std::string> arr2(7, "foo");
+        REQUIRE(arr2.size() == 7);
+        CHECK(std::all_of(arr2.begin(), arr2.end(), [](const std::string& str) { return str == "foo"; }));
+
+        const cpp_util::thin_dynarray<std::string> arr3(3, cpp_util::for_overwrite);
+        CHECK(std::all_of(arr3.begin(), arr3.end(), [](const std::string& str) { return str.empty(); }));
+    }
+
+    SECTION("iterator range and initializer_list constructor") {
+        const std::vector<std::string> vec{ "a", "b", "c" };
+        const cpp_util::thin_dynarray<std::string> arr(vec.begin(), vec.end());
+        REQUIRE(arr.size() == 3);
+        CHECK(std::equal(arr.begin(), arr.end(), vec.begin()));
+
+        const cpp_util::thin_dynarray<char> chars{ 'a', 'b', 'c', 'd', 'e' };
+        REQUIRE(chars.size() == 5);
+        CHECK(chars.back() == 'e');
+    }
+
+#if defined(__cpp_aligned_new)
+    SECTION("over-aligned elements") {
+        const cpp_util::thin_dynarray<over_aligned> arr(3);
+        REQUIRE(arr.size() == 3);
+        CHECK(reinterpret_cast<std::uintptr_t>(arr.data()) % 64 == 0);
+    }
+#endif
+
+    SECTION("exception safety") {
+        throwing_type::constructions = 0;
+        throwing_type::throw_at = 3;
+        throwing_type::live = 0;
+        CHECK_THROWS_AS(cpp_util::thin_dynarray<throwing_type>(5), std::runtime_error);
+        CHECK(throwing_type::live == 0);
+
+        throwing_type::constructions = 0;
+        CHECK_THROWS_AS(cpp_util::thin_dynarray<throwing_type>(5, throwing_type{}), std::runtime_error);
+        CHECK(throwing_type::live == 0);
+        throwing_type::throw_at = -1;
+    }
+}
+
+TEST_CASE("thin_dynarray copy, move, and swap", "[thin_dynarray]") {
+    cpp_util::thin_dynarray<std::string> arr(5, "foo");
+
+    SECTION("copy") {
+        const cpp_util::thin_dynarray<std::string> copy{ arr };
+        CHECK(copy == arr);
+        CHECK(copy.data() != arr.data());
+
+        cpp_util::thin_dynarray<std::string> assigned(2, "bar");
+        assigned = copy;
+        CHECK(assigned == arr);
+        assigned = cpp_util::thin_dynarray<std::string>{};
+        CHECK(assigned.empty());
+    }
+
+    SECTION("move") {
+        const std::string* data = arr.data();
+        cpp_util::thin_dynarray<std::string> moved{ std::move(arr) };
+        CHECK(arr.empty());
+        CHECK(moved.data() == data);
+        CHECK(moved.size() == 5);
+
+        cpp_util::thin_dynarray<std::string> assigned(2, "bar");
+        assigned = std::move(moved);
+        CHECK(moved.empty());
+        CHECK(assigned.data() == data);
+    }
+
+    SECTION("swap") {
+        cpp_util::thin_dynarray<std::string> other(2, "bar");
+        swap(arr, other);
+        CHECK(arr.size() == 2);
+        CHECK(other.size() == 5);
+        CHECK(other.front() == "foo");
+    }
+
+    SECTION("assign") {
+        arr.assign(5, "bar");
+        CHECK(arr.back() == "bar");
+        arr.assign({ "x", "y" });
+        REQUIRE(arr.size() == 2);
+        CHECK(arr[1] == "y");
+        arr = { "z" };
+        CHECK(arr.size() == 1);
+    }
+}
+
+TEST_CASE("thin_dynarray element access and operations", "[thin_dynarray]") {
+    cpp_util::thin_dynarray<int> arr(6);
+
+    CHECK_THROWS_AS(arr.at(6), std::out_of_range);
+    arr.at(1) = 1;
+    CHECK(arr[1] == 1);
+
+    arr.iota(1);
+    CHECK(arr.front() == 1);
+    CHECK(arr.back() == 6);
+    CHECK(*arr.rbegin() == 6);
+    CHECK(arr.crend() - arr.crbegin() == 6);
+
+    arr.fill(cpp_util::par, 42);
+    CHECK(std::all_of(arr.cbegin(), arr.cend(), [](const int i) { return i == 42; }));
+    arr.generate(cpp_util::par, [](const std::size_t pos) { return static_cast<int>(pos); });
+    CHECK(arr.back() == 5);
+
+    const cpp_util::thin_dynarray<int> other{ 0, 1, 2, 3, 4, 5 };
+    CHECK(arr == other);
+    CHECK_FALSE(arr < other);
+    CHECK(cpp_util::thin_dynarray<int>{ 0, 1, 2 } < other);
+}
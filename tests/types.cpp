@@ -9,6 +9,8 @@
 
 #include "catch/catch.hpp"
 
+#include <cstdint>      // std::uint16_t
+#include <memory>       // std::allocator
 #include <type_traits>  // std::is_same
 
 TEST_CASE("dynarray member types", "[types]") {
@@ -25,4 +27,7 @@ TEST_CASE("dynarray member types", "[types]") {
     CHECK(std::is_same<typename array_type::const_iterator, const int *>::value);
     CHECK(std::is_same<typename array_type::reverse_iterator, std::reverse_iterator<int *>>::value);
     CHECK(std::is_same<typename array_type::const_reverse_iterator, std::reverse_iterator<const int *>>::value);
+
+    // configurable size_type
+    CHECK(std::is_same<typename cpp_util::dynarray<int, std::allocator<int>, std::uint16_t>::size_type, std::uint16_t>::value);
 }
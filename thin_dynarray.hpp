@@ -0,0 +1,354 @@
+/**
+ * Copyright (C) 2021 - Marcel Breyer - All Rights Reserved
+ * Licensed under the MIT License. See LICENSE.md file in the project root for full license information.
+ *
+ * Implements a runtime fixed-size array occupying a single pointer by storing its size in front of the elements.
+ */
+
+#ifndef CPP_UTIL_THIN_DYNARRAY_HPP
+#define CPP_UTIL_THIN_DYNARRAY_HPP
+
+#include "dynarray.hpp"
+
+#include <algorithm>         // std::fill, std::copy, std::generate, std::swap
+#include <cassert>           // assert
+#include <cstddef>           // std::size_t, std::ptrdiff_t, std::max_align_t
+#include <cstring>           // std::memcpy
+#include <initializer_list>  // std::initializer_list
+#include <iterator>          // std::reverse_iterator, std::distance, std::iterator_traits, std::forward_iterator_tag
+#include <limits>            // std::numeric_limits
+#include <memory>            // std::allocator, std::addressof, std::uninitialized_copy, std::uninitialized_fill
+#include <new>               // std::bad_alloc, placement new
+#include <numeric>           // std::iota
+#include <stdexcept>         // std::out_of_range
+#include <type_traits>       // std::enable_if, std::is_convertible, std::is_same, std::remove_cv, std::is_trivially_default_constructible
+#include <utility>           // std::move
+
+#if __has_include(<compare>)
+#include <compare>  // std::strong_ordering
+#endif
+
+namespace cpp_util {
+
+/**
+ * @brief A runtime fixed-size array like cpp_util::dynarray with `sizeof(thin_dynarray<T>) == sizeof(T*)`: the size is stored in a header
+ *        directly in front of the elements in the same allocation (using `std::allocator`). Empty arrays don't allocate any memory,
+ *        i.e., `data()` is `nullptr`. Reading the size dereferences the pointer, hence, prefer cpp_util::dynarray if the size
+ *        is queried frequently and the number of arrays is small.
+ */
+template <typename T>
+class thin_dynarray {
+ public:
+  /**************************************************************************************************************************************/
+  /**                                                              types                                                               **/
+  /**************************************************************************************************************************************/
+  using value_type = T;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using pointer = value_type*;
+  using const_pointer = const value_type*;
+  using iterator = pointer;
+  using const_iterator = const_pointer;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  static_assert(std::is_same<typename std::remove_cv<value_type>::type, value_type>::value,
+                "cpp_util::thin_dynarray must have a non-const, non-volatile value_type");
+#if !defined(__cpp_aligned_new)
+  static_assert(alignof(value_type) <= alignof(std::max_align_t), "cpp_util::thin_dynarray requires aligned new for over-aligned types");
+#endif
+
+ private:
+  // the unit of allocation: suitably aligned for the header as well as for the elements
+  static constexpr std::size_t block_alignment = alignof(value_type) > alignof(size_type) ? alignof(value_type) : alignof(size_type);
+  struct alignas(block_alignment) block {
+    unsigned char bytes[block_alignment];
+  };
+
+ public:
+  /**************************************************************************************************************************************/
+  /**                                                           construction                                                           **/
+  /**************************************************************************************************************************************/
+  constexpr thin_dynarray() noexcept = default;
+  explicit thin_dynarray(const size_type size) : thin_dynarray(size, value_init) {}
+  thin_dynarray(const size_type size, value_init_t) : data_{ this->allocate_storage(size) } {
+    // value-initialize all elements
+    this->construct_elements(size, [](pointer ptr) { ::new (static_cast<void*>(ptr)) value_type(); });
+  }
+  thin_dynarray(const size_type size, for_overwrite_t) : data_{ this->allocate_storage(size) } {
+    // default-initialize all elements
+    if (!std::is_trivially_default_constructible<value_type>::value) {
+      this->construct_elements(size, [](pointer ptr) { ::new (static_cast<void*>(ptr)) value_type; });
+    }
+  }
+  thin_dynarray(const size_type size, const value_type& init) : data_{ this->allocate_storage(size) } {
+    // initialize with same value
+    this->construct_elements_from([&]() { std::uninitialized_fill(data_, data_ + size, init); });
+  }
+  template <typename ForwardIt, typename std::enable_if<std::is_convertible<typename std::iterator_traits<ForwardIt>::iterator_category,
+                                                                            std::forward_iterator_tag>::value,
+                                                        bool>::type = true>
+  thin_dynarray(ForwardIt first, ForwardIt last) : data_{ this->allocate_storage(static_cast<size_type>(std::distance(first, last))) } {
+    // copy values from iterator range (trivially copyable types result in a single std::memmove)
+    this->construct_elements_from([&]() { std::uninitialized_copy(first, last, data_); });
+  }
+  thin_dynarray(std::initializer_list<value_type> ilist) : thin_dynarray(ilist.begin(), ilist.end()) {}
+  thin_dynarray(const thin_dynarray& other) : thin_dynarray(other.cbegin(), other.cend()) {}
+  thin_dynarray(thin_dynarray&& other) noexcept : data_{ detail::exchange(other.data_, nullptr) } {}
+
+  /**************************************************************************************************************************************/
+  /**                                                           destruction                                                            **/
+  /**************************************************************************************************************************************/
+  ~thin_dynarray() {
+    const size_type size = this->size();
+    this->destroy_elements(data_, data_ + size);
+    this->deallocate_storage(data_, size);
+  }
+
+  /**************************************************************************************************************************************/
+  /**                                                            assignment                                                            **/
+  /**************************************************************************************************************************************/
+  thin_dynarray& operator=(const thin_dynarray& other) {
+    // guard against self assignment
+    if (this != std::addressof(other)) {
+      this->assign(other.cbegin(), other.cend());
+    }
+    return *this;
+  }
+  thin_dynarray& operator=(thin_dynarray&& other) noexcept {
+    // our old memory gets released by tmp
+    thin_dynarray tmp{ std::move(other) };
+    this->swap(tmp);
+    return *this;
+  }
+  thin_dynarray& operator=(std::initializer_list<value_type> ilist) {
+    this->assign(ilist.begin(), ilist.end());
+    return *this;
+  }
+
+  void assign(const size_type count, const value_type& value) {
+    // if sizes mismatch use copy-and-swap idiom,
+    // otherwise just directly assign new values
+    if (count != this->size()) {
+      thin_dynarray tmp(count, value);
+      this->swap(tmp);
+    } else {
+      this->fill(value);
+    }
+  }
+  template <typename ForwardIt, typename std::enable_if<std::is_convertible<typename std::iterator_traits<ForwardIt>::iterator_category,
+                                                                            std::forward_iterator_tag>::value,
+                                                        bool>::type = true>
+  void assign(ForwardIt first, ForwardIt last) {
+    // if sizes mismatch use copy-and-swap idiom,
+    // otherwise just directly assign new values
+    if (static_cast<size_type>(std::distance(first, last)) != this->size()) {
+      thin_dynarray tmp(first, last);
+      this->swap(tmp);
+    } else {
+      std::copy(first, last, this->begin());
+    }
+  }
+  void assign(std::initializer_list<value_type> ilist) { this->assign(ilist.begin(), ilist.end()); }
+
+  /**************************************************************************************************************************************/
+  /**                                                          element access                                                          **/
+  /**************************************************************************************************************************************/
+  DYNARRAY_NODISCARD reference at(const size_type pos) {
+    if (pos >= this->size()) throw std::out_of_range{ "Index out-of-range: pos >= this->size()" };
+    return data_[pos];
+  }
+  DYNARRAY_NODISCARD const_reference at(const size_type pos) const {
+    if (pos >= this->size()) throw std::out_of_range{ "Index out-of-range: pos >= this->size()" };
+    return data_[pos];
+  }
+  DYNARRAY_NODISCARD reference operator[](const size_type pos) {
+    assert((pos < this->size()) && "Undefined behavior if pos >= this->size()!");
+    return data_[pos];
+  }
+  DYNARRAY_NODISCARD const_reference operator[](const size_type pos) const {
+    assert((pos < this->size()) && "Undefined behavior if pos >= this->size()!");
+    return data_[pos];
+  }
+  DYNARRAY_NODISCARD reference front() {
+    assert((!this->empty()) && "Calling front() is undefined for empty thin_dynarrays!");
+    return data_[0];
+  }
+  DYNARRAY_NODISCARD const_reference front() const {
+    assert((!this->empty()) && "Calling front() is undefined for empty thin_dynarrays!");
+    return data_[0];
+  }
+  DYNARRAY_NODISCARD reference back() {
+    assert((!this->empty()) && "Calling back() is undefined for empty thin_dynarrays!");
+    return data_[this->size() - 1];
+  }
+  DYNARRAY_NODISCARD const_reference back() const {
+    assert((!this->empty()) && "Calling back() is undefined for empty thin_dynarrays!");
+    return data_[this->size() - 1];
+  }
+  DYNARRAY_NODISCARD pointer data() noexcept { return data_; }
+  DYNARRAY_NODISCARD const_pointer data() const noexcept { return data_; }
+
+  /**************************************************************************************************************************************/
+  /**                                                         iterator support                                                         **/
+  /**************************************************************************************************************************************/
+  DYNARRAY_NODISCARD iterator begin() noexcept { return data_; }
+  DYNARRAY_NODISCARD iterator end() noexcept { return data_ + this->size(); }
+  DYNARRAY_NODISCARD const_iterator begin() const noexcept { return data_; }
+  DYNARRAY_NODISCARD const_iterator end() const noexcept { return data_ + this->size(); }
+  DYNARRAY_NODISCARD const_iterator cbegin() const noexcept { return data_; }
+  DYNARRAY_NODISCARD const_iterator cend() const noexcept { return data_ + this->size(); }
+  DYNARRAY_NODISCARD reverse_iterator rbegin() noexcept { return detail::make_reverse_iterator(this->end()); }
+  DYNARRAY_NODISCARD reverse_iterator rend() noexcept { return detail::make_reverse_iterator(this->begin()); }
+  DYNARRAY_NODISCARD const_reverse_iterator rbegin() const noexcept { return detail::make_reverse_iterator(this->end()); }
+  DYNARRAY_NODISCARD const_reverse_iterator rend() const noexcept { return detail::make_reverse_iterator(this->begin()); }
+  DYNARRAY_NODISCARD const_reverse_iterator crbegin() const noexcept { return detail::make_reverse_iterator(this->end()); }
+  DYNARRAY_NODISCARD const_reverse_iterator crend() const noexcept { return detail::make_reverse_iterator(this->begin()); }
+
+  /**************************************************************************************************************************************/
+  /**                                                             capacity                                                             **/
+  /**************************************************************************************************************************************/
+  DYNARRAY_NODISCARD bool empty() const noexcept { return data_ == nullptr; }
+  DYNARRAY_NODISCARD size_type size() const noexcept {
+    if (data_ == nullptr) {
+      return 0;
+    }
+    size_type size;
+    std::memcpy(&size, this->header(data_), sizeof(size_type));
+    return size;
+  }
+  DYNARRAY_NODISCARD static constexpr size_type max_size() noexcept {
+    return (static_cast<size_type>(std::numeric_limits<difference_type>::max()) - header_blocks() * sizeof(block)) / sizeof(value_type);
+  }
+
+  /**************************************************************************************************************************************/
+  /**                                                            operations                                                            **/
+  /**************************************************************************************************************************************/
+  void swap(thin_dynarray& other) noexcept { std::swap(data_, other.data_); }
+  void fill(const value_type& value = value_type{}) { std::fill(this->begin(), this->end(), value); }
+  void iota(const value_type& value = value_type{}) { std::iota(this->begin(), this->end(), value); }
+  template <typename Generator>
+  void generate(Generator gen) {
+    std::generate(this->begin(), this->end(), gen);
+  }
+  void fill(const parallel_policy& policy, const value_type& value = value_type{}) {
+    detail::parallel_for_chunks(data_, this->size(), policy.num_threads(), [&](const size_type first, const size_type last) {
+      std::fill(data_ + first, data_ + last, value);
+    });
+  }
+  // the start value of each chunk is computed directly as value + first
+  void iota(const parallel_policy& policy, const value_type& value = value_type{}) {
+    detail::parallel_for_chunks(data_, this->size(), policy.num_threads(), [&](const size_type first, const size_type last) {
+      std::iota(data_ + first, data_ + last, static_cast<value_type>(value + static_cast<value_type>(first)));
+    });
+  }
+  // the generator is called as gen(pos) for each position (concurrently, i.e., it must be thread-safe)
+  template <typename Generator>
+  void generate(const parallel_policy& policy, Generator gen) {
+    detail::parallel_for_chunks(data_, this->size(), policy.num_threads(), [&](const size_type first, const size_type last) {
+      for (size_type pos = first; pos < last; ++pos) {
+        data_[pos] = gen(pos);
+      }
+    });
+  }
+
+  /**************************************************************************************************************************************/
+  /**                                                       non-member functions                                                       **/
+  /**************************************************************************************************************************************/
+  // integral and byte element types are compared using std::memcmp or SSE2 (see detail::lexicographical_compare_bitwise)
+#if defined(__cpp_impl_three_way_comparison) && defined(__cpp_lib_three_way_comparison)
+  DYNARRAY_NODISCARD friend bool operator==(const thin_dynarray& lhs, const thin_dynarray& rhs) noexcept {
+    return lhs.size() == rhs.size() && detail::equal_elements(lhs.data(), rhs.data(), lhs.size(), detail::is_bitwise_comparable<T>{});
+  }
+  DYNARRAY_NODISCARD friend std::strong_ordering operator<=>(const thin_dynarray& lhs, const thin_dynarray& rhs) noexcept {
+    return lhs.size() != rhs.size() ? lhs.size() <=> rhs.size()
+                                    : detail::lexicographical_compare_three_way(lhs.data(), lhs.size(), rhs.data(), rhs.size(),
+                                                                                detail::is_bitwise_comparable<T>{});
+  }
+#else
+  DYNARRAY_NODISCARD friend bool operator==(const thin_dynarray& lhs, const thin_dynarray& rhs) noexcept {
+    return lhs.size() == rhs.size() && detail::equal_elements(lhs.data(), rhs.data(), lhs.size(), detail::is_bitwise_comparable<T>{});
+  }
+  DYNARRAY_NODISCARD friend bool operator!=(const thin_dynarray& lhs, const thin_dynarray& rhs) noexcept { return !(lhs == rhs); }
+  DYNARRAY_NODISCARD friend bool operator<(const thin_dynarray& lhs, const thin_dynarray& rhs) noexcept {
+    return detail::lexicographical_less(lhs.data(), lhs.size(), rhs.data(), rhs.size(), detail::is_bitwise_comparable<T>{});
+  }
+  DYNARRAY_NODISCARD friend bool operator>(const thin_dynarray& lhs, const thin_dynarray& rhs) noexcept { return rhs < lhs; }
+  DYNARRAY_NODISCARD friend bool operator<=(const thin_dynarray& lhs, const thin_dynarray& rhs) noexcept { return !(rhs < lhs); }
+  DYNARRAY_NODISCARD friend bool operator>=(const thin_dynarray& lhs, const thin_dynarray& rhs) noexcept { return !(lhs < rhs); }
+#endif
+
+ private:
+  /**************************************************************************************************************************************/
+  /**                                                        memory management                                                         **/
+  /**************************************************************************************************************************************/
+  // the number of blocks occupied by the header
+  static constexpr size_type header_blocks() noexcept { return (sizeof(size_type) + sizeof(block) - 1) / sizeof(block); }
+  static constexpr size_type allocation_blocks(const size_type size) noexcept {
+    return header_blocks() + (size * sizeof(value_type) + sizeof(block) - 1) / sizeof(block);
+  }
+  static block* header(const_pointer data) noexcept {
+    return reinterpret_cast<block*>(const_cast<pointer>(data)) - header_blocks();
+  }
+
+  static pointer allocate_storage(const size_type size) {
+    // empty arrays don't allocate
+    if (size == 0) {
+      return nullptr;
+    }
+    if (size > max_size()) {
+      throw std::bad_alloc{};
+    }
+    block* ptr = std::allocator<block>{}.allocate(allocation_blocks(size));
+    std::memcpy(ptr, &size, sizeof(size_type));
+    return reinterpret_cast<pointer>(ptr + header_blocks());
+  }
+  static void deallocate_storage(pointer data, const size_type size) noexcept {
+    if (data != nullptr) {
+      std::allocator<block>{}.deallocate(header(data), allocation_blocks(size));
+    }
+  }
+  // construct every element using construct(ptr); on failure, the already constructed elements are destroyed
+  template <typename Construct>
+  void construct_elements(const size_type size, Construct construct) {
+    size_type constructed = 0;
+    try {
+      for (; constructed < size; ++constructed) {
+        construct(data_ + constructed);
+      }
+    } catch (...) {
+      // the destructor won't run for a partially constructed thin_dynarray -> clean up before rethrowing
+      this->destroy_elements(data_, data_ + constructed);
+      this->deallocate_storage(data_, size);
+      throw;
+    }
+  }
+  // the uninitialized algorithms already destroy the constructed elements on failure
+  template <typename Construct>
+  void construct_elements_from(Construct construct) {
+    try {
+      construct();
+    } catch (...) {
+      this->deallocate_storage(data_, this->size());
+      throw;
+    }
+  }
+  static void destroy_elements(pointer first, pointer last) noexcept {
+    for (; first != last; ++first) {
+      first->~value_type();
+    }
+  }
+
+  pointer data_{ nullptr };
+};
+
+template <typename T>
+void swap(thin_dynarray<T>& lhs, thin_dynarray<T>& rhs) noexcept {
+  lhs.swap(rhs);
+}
+
+}  // namespace cpp_util
+
+#endif  // CPP_UTIL_THIN_DYNARRAY_HPP